@@ -23,6 +23,7 @@ Throw: [
 	continue:           {no loop to continue}
 	halt:               [{halted by user or script}]
 	quit:               [{user script quit}]
+	tail-call:          {tail call not in function}
 ]
 
 Note: [
@@ -243,6 +243,12 @@ recycle: native [
 	/ballast {Trigger for auto-recycle (memory used)}
 	size [integer!]
 	/torture {Constant recycle (for internal debugging)}
+	/generational {Auto-recycle only new series (all, every few times)}
+	state [logic!]
+	/incremental {Auto-recycle in slices of this many values (none for all at once)}
+	budget [integer! none!]
+	/parallel {Sweep with this many threads}
+	threads [integer!]
 ]
 
 reduce: native [
@@ -289,6 +295,15 @@ throw: native [
 	word [word!]
 ]
 
+profile: native [
+	{Evaluates a block, sampling the function calls. Returns [word self total] counts.}
+	block [block!]
+	/rate {Evaluations per sample (default 1000)}
+	n [integer!]
+	/collapsed {Return a string of call stacks and counts, for flame graph tools}
+	/memory {Count the series made by each function instead. Returns [word function made bytes live live-bytes]}
+]
+
 trace: native [
 	{Enables and disables evaluation tracing and backtrace.}
 	mode [integer! logic!]
@@ -925,6 +940,7 @@ stats: native [
 	/profile {Returns profiler object}
 	/timer {High resolution time difference from start}
 	/evals {Number of values evaluated by interpreter}
+	/heap {Recycle, and return a snapshot of the series alive (binary)}
 ]
 
 do-codec: native [
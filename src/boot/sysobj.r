@@ -265,6 +265,8 @@ standard: context [
 		made-blocks:
 		made-objects:
 		recycles:
+		segs-released:	; pool segments returned to the OS
+		bytes-released:
 			none
 	]
 
@@ -81,7 +81,7 @@ REBOL [
 	native      function    function    *        -       -      *   function  
 	action      function    function    *        -       -      *   function  
 ;	routine     function    routine     -        -       -      *   function  
-	rebcode     function    0           -        -       -      *   function  
+	rebcode     function    function    -        -       -      *   function  
 	command     function    function    -        -       -      *   function  
 ;	macro       function    0           -        -       -      -   function  
 	op          operator    function    -        -       -      *   function  
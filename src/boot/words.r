@@ -190,6 +190,9 @@ on-top
 hidden
 owner
 
+; Dialects:
+rebcode
+
 *port-modes*
 
 bits
@@ -810,6 +810,8 @@ RL_API int RL_Set_Value(REBSER *series, u32 index, RXIARG val, int type)
 		Append_Val(series, &value);
 		return TRUE;
 	}
+	UNCOMPILE_BLOCK(series);
+	REMEMBER_SERIES(series);
 	*BLK_SKIP(series, index) = value;
 	return FALSE;
 }
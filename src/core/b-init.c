@@ -343,8 +343,7 @@ extern const REBYTE Str_Banner[];
 {
 	REBVAL *spec = D_ARG(1);
 
-	SET_OBJECT(ds, Make_Object(0, VAL_BLK(spec)));
-	Bind_Block(VAL_OBJ_FRAME(ds), VAL_BLK(spec), BIND_ONLY); // not deep
+	SET_OBJECT(ds, Make_Bound_Object(0, VAL_BLK(spec), BIND_ONLY, FALSE)); // not deep
 	Do_Blk(VAL_SERIES(spec), 0); // result ignored
 	return R_RET;
 }
@@ -577,7 +576,7 @@ extern const REBYTE Str_Banner[];
 
 	// Create the system object from the sysobj block:
 	value = VAL_BLK(&Boot_Block->sysobj);
-	frame = Make_Object(0, value);
+	frame = Make_Object(0, value, FALSE);
 
 	// Bind it so CONTEXT native will work and bind its fields:
 	Bind_Block(Lib_Context, value, BIND_DEEP);
@@ -864,7 +863,6 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Init_Task_Context();	// Special REBOL values per task
 
 	Init_Raw_Print();
-	Init_Words(TRUE);
 	Init_Data_Stack(STACK_MIN/4);
 	Init_Scanner();
 	Init_Mold(MIN_COMMON/4);
@@ -932,7 +930,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	Init_Char_Cases();
 	Init_CRC();				// For word hashing
 	Set_Random(0);
-	Init_Words(FALSE);		// Symbol table
+	Init_Words();			// Symbol table
 	Init_Data_Stack(STACK_MIN*4);
 	Init_Scanner();
 	Init_Mold(MIN_COMMON);	// Output buffer
@@ -961,6 +959,7 @@ static REBCNT Set_Option_Word(REBCHR *str, REBCNT field)
 	DOUT("Level 4");
 	Init_Natives();			// Built-in native functions
 	Init_Ops();				// Built-in operators
+	Init_Rebcode();			// Rebcode opcode words
 	Init_System_Object();
 	Init_Contexts_Object();
 	Init_Main_Args(rargs);
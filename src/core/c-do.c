@@ -60,8 +60,6 @@ void T_Series(REBCNT n) {;}		// image
 void T_List(REBCNT n) {;}		// list
 */
 
-void Do_Rebcode(REBVAL *v) {;}
-
 #include "tmp-evaltypes.h"
 
 #define EVAL_TYPE(val) (Eval_Type_Map[VAL_TYPE(val)])
@@ -403,6 +401,7 @@ void Trace_Arg(REBINT num, REBVAL *arg, REBVAL *path)
 		break;
 	case PE_SET: // only sets if end of path
 		if (pvs->setval && IS_END(pvs->path+1)) {
+			NOTE_OP_SET(pvs->setval);
 			*pvs->value = *pvs->setval;
 			pvs->setval = 0;
 		}
@@ -514,7 +513,10 @@ void Trace_Arg(REBINT num, REBVAL *arg, REBVAL *path)
 	case PE_OK:
 		break;
 	case PE_SET: // only sets if end of path
-		if (pvs.setval) *pvs.value = *pvs.setval;
+		if (pvs.setval) {
+			NOTE_OP_SET(pvs.setval);
+			*pvs.value = *pvs.setval;
+		}
 		break;
 	case PE_NONE:
 		SET_NONE(pvs.store);
@@ -609,7 +611,8 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 /*
 **		Evaluate code block according to the function arg spec.
 **		Args are pushed onto the data stack in the same order
-**		as the function frame.
+**		as the function frame. The arg plan of the function gives
+**		the kind of each arg and finds refinements by symbol.
 **
 **			func:  function or path value
 **			path:  refinements or object/function path
@@ -621,6 +624,11 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 	REBVAL *value;
 	REBVAL *args;
 	REBSER *words;
+	REBSER *plan;
+	REBCNT *kinds;
+	REBCNT *refs;
+	REBCNT len;
+	REBCNT n;
 	REBINT ds = 0;			// stack argument position
 	REBINT dsp = DSP + 1;	// stack base
 	REBINT dsf = dsp - DSF_BIAS;
@@ -633,15 +641,15 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 
 	// Get list of words:
 	words = VAL_FUNC_WORDS(func);
-	args = BLK_SKIP(words, 1);
-	ds = SERIES_TAIL(words)-1;	// length of stack fill below
-	//Debug_Fmt("Args: %z", VAL_FUNC_ARGS(func));
+	plan = ARG_PLAN(words);
+	kinds = PLAN_KINDS(plan);
+	len = SERIES_TAIL(words);
+	n = 1;
+	ds = len - 1;	// length of stack fill below
 
 	// If func is operator, first arg is already on stack:
 	if (IS_OP(func)) {
-		//if (!TYPE_CHECK(args, VAL_TYPE(DS_VALUE(DSP))))
-		//	Trap3(RE_EXPECT_ARG, Func_Word(dsf), args, Of_Type(DS_VALUE(ds)));
-		args++;	 	// skip evaluation, but continue with type check
+		n++;	 	// skip evaluation, but continue with type check
 		ds--;		// shorten stack fill below
 	}
 
@@ -652,21 +660,21 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 
 	// Go thru the word list args:
 	ds = dsp;
-	for (; NOT_END(args); args++, ds++) {
+	for (; n < len; n++, ds++) {
 
-		//if (Trace_Flags) Trace_Arg(ds - dsp, args, path);
+		args = BLK_SKIP(words, n);
 
 		// Process each formal argument:
-		switch (VAL_TYPE(args)) {
+		switch (kinds[n] & ARG_KIND) {
 
-		case REB_WORD:		// WORD - Evaluate next value
+		case ARG_EVAL:		// WORD - Evaluate next value
 			index = Do_Next(block, index, IS_OP(func));
 			// THROWN is handled after the switch.
 			if (index == END_FLAG) Trap2(RE_NO_ARG, Func_Word(dsf), args);
 			DS_Base[ds] = *DS_POP;
 			break;
 
-		case REB_LIT_WORD:	// 'WORD - Just get next value
+		case ARG_QUOTE:		// 'WORD - Just get next value
 			if (index < BLK_LEN(block)) {
 				value = BLK_SKIP(block, index);
 				if (IS_PAREN(value) || IS_GET_WORD(value) || IS_GET_PATH(value)) {
@@ -682,70 +690,138 @@ x*/	static REBINT Do_Args_Light(REBVAL *func, REBVAL *path, REBSER *block, REBCN
 				SET_UNSET(&DS_Base[ds]); // allowed to be none
 			break;
 
-		case REB_GET_WORD:	// :WORD - Get value
+		case ARG_GET:		// :WORD - Get value
 			if (index < BLK_LEN(block)) {
 				DS_Base[ds] = *BLK_SKIP(block, index);
 				index++;
 			} else
 				SET_UNSET(&DS_Base[ds]); // allowed to be none
 			break;
-/*
-				value = BLK_SKIP(block, index);
-				index++;
-				if (IS_WORD(value) && VAL_WORD_FRAME(value)) value = Get_Var(value);
-				DS_Base[ds] = *value;
-*/
-		case REB_REFINEMENT: // /WORD - Function refinement
+
+		case ARG_REFINE:	// /WORD - Function refinement
 			if (!path || IS_END(path)) return index;
-			if (IS_WORD(path)) {
-				// Optimize, if the refinement is the next arg:
-				if (SAME_SYM(path, args)) {
-					SET_TRUE(DS_VALUE(ds)); // set refinement stack value true
-					path++;				// remove processed refinement
-					continue;
-				}
-				// Refinement out of sequence, resequence arg order:
+			// Unless the refinement is the next arg, resequence arg order:
+			if (!IS_WORD(path) || !SAME_SYM(path, args)) {
 more_path:
-				ds = dsp;
-				args = BLK_SKIP(words, 1);
-				for (; NOT_END(args); args++, ds++) {
-					if (IS_REFINEMENT(args) && VAL_WORD_CANON(args) == VAL_WORD_CANON(path)) {
-						SET_TRUE(DS_VALUE(ds)); // set refinement stack value true
-						path++;				// remove processed refinement
-						break;
-					}
-				}
+				if (!IS_WORD(path)) Trap1(RE_BAD_REFINE, path);
+				refs = PLAN_REFINES(plan);
+				for (n = PLAN_VALUE(plan, PLAN_REFS); n > 0; n--, refs += 2)
+					if (refs[0] == VAL_WORD_CANON(path)) break;
 				// Was refinement found? If not, error:
-				if (IS_END(args)) Trap2(RE_NO_REFINE, Func_Word(dsf), path);
-				continue;
+				if (!n) Trap2(RE_NO_REFINE, Func_Word(dsf), path);
+				n = refs[1];
+				ds = dsf + DSF_SIZE + n;
 			}
-			else Trap1(RE_BAD_REFINE, path);
-			break;
+			SET_TRUE(DS_VALUE(ds)); // set refinement stack value true
+			path++;				// remove processed refinement
+			continue;
 
-		case REB_SET_WORD:	// WORD: - reserved for special features
-		default:
+		default:			// WORD: - reserved for special features
 			Trap_Arg(args);
 		}
 
-		if (THROWN(DS_VALUE(ds))) {
+		value = DS_VALUE(ds);
+		if (THROWN(value)) {
 			// Store THROWN value in TOS, so that Do_Next can handle it.
-			*DS_TOP = *DS_VALUE(ds);
+			*DS_TOP = *value;
 			return index;
 		}
 
-		// If word is typed, verify correct argument datatype:
-		if (!TYPE_CHECK(args, VAL_TYPE(DS_VALUE(ds))))
-			Trap3(RE_EXPECT_ARG, Func_Word(dsf), args, Of_Type(DS_VALUE(ds)));
+		// If word is typed (or the value unset), verify correct argument datatype:
+		if (((kinds[n] & ARG_TYPED) || IS_UNSET(value)) && !TYPE_CHECK(args, VAL_TYPE(value)))
+			Trap3(RE_EXPECT_ARG, Func_Word(dsf), args, Of_Type(value));
+
+		// A value of a shared closure body must not be kept:
+		if ((VAL_GET_OPT(value, OPTS_SHARE) || (ANY_WORD(value) && VAL_WORD_INDEX(value) < 0))
+			&& !VAL_GET_OPT(args, OPTS_SHARE)) Unshare_Value(value);
 	}
 
 	// Hack to process remaining path:
 	if (path && NOT_END(path)) goto more_path;
-	//	Trap2(RE_NO_REFINE, Func_Word(dsf), path);
 
 	return index;
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Do_Plan_Args(REBSER *words, REBCNT argc, REBSER *block, REBCNT index, REBFLG op)
+/*
+**		Fast form of Do_Args for a call site that has a code cell
+**		plan: the function takes argc word args, followed only by
+**		refinements and locals (which start as none). Each arg is
+**		evaluated directly into its stack slot.
+**
+**			words: args of the function
+**			argc:  number of word args to evaluate
+**			op:    infix operator (first arg is already on stack)
+**
+***********************************************************************/
+{
+	REBVAL *args = BLK_SKIP(words, 1);
+	REBCNT *kinds = PLAN_KINDS(ARG_PLAN(words)) + 1;
+	REBINT dsf = DSP + 1 - DSF_BIAS;
+	REBCNT fill = SERIES_TAIL(words) - 1 - argc;
+
+	if ((DSP + 100) > (REBINT)SERIES_REST(DS_Series))
+		Trap0(RE_STACK_OVERFLOW);
+
+	if (op) {
+		dsf--;
+		args++;
+		kinds++;
+		argc--;
+	}
+
+	for (; argc > 0; argc--, args++, kinds++) {
+		index = Do_Next(block, index, op);
+		if (index == END_FLAG) Trap2(RE_NO_ARG, Func_Word(dsf), args);
+		if (THROWN(DS_TOP)) return index; // Do_Next handles it
+		if (((*kinds & ARG_TYPED) || IS_UNSET(DS_TOP)) && !TYPE_CHECK(args, VAL_TYPE(DS_TOP)))
+			Trap3(RE_EXPECT_ARG, Func_Word(dsf), args, Of_Type(DS_TOP));
+		if (VAL_GET_OPT(DS_TOP, OPTS_SHARE) && !VAL_GET_OPT(args, OPTS_SHARE))
+			Unshare_Value(DS_TOP);
+	}
+
+	for (; fill > 0; fill--) DS_PUSH_NONE;
+
+	return index;
+}
+
+
+/***********************************************************************
+**
+*/	static void Reset_Op_Cells(REBSER *code)
+/*
+**		An op! was stored into some variable since the cells of this
+**		block were last checked, so words that were not ops may be
+**		now. Forget them all and restamp the block.
+**
+***********************************************************************/
+{
+	REBCOD *cell = CODE_SKIP(code, 0);
+	REBCNT n;
+
+	for (n = 0; n < SERIES_TAIL(code); n++, cell++) cell->kind &= ~CODE_NOT_OP;
+	code->size = Op_Epoch;
+}
+
+
+/***********************************************************************
+**
+*/	static void Plan_Call(REBSER *block, REBCOD *cell, REBVAL *func)
+/*
+**		Record the function called from a code cell of the block,
+**		and whether its args can be gathered by Do_Plan_Args.
+**
+***********************************************************************/
+{
+	REMEMBER_SERIES(block); // cell refers to args series
+	cell->args = VAL_FUNC_ARGS(func);
+	cell->argc = PLAN_VALUE(ARG_PLAN(VAL_FUNC_WORDS(func)), PLAN_ARGC);
+}
+
+
 /***********************************************************************
 **
 */	void Do_Signals(void)
@@ -765,6 +841,7 @@ more_path:
 		Eval_Count = Eval_Dose;
 		if (Eval_Limit != 0 && Eval_Cycles > Eval_Limit)
 			Check_Security(SYM_EVAL, POL_EXEC, 0);
+		if (Prof_Stacks) Sample_Stack();
 	}
 
 	if (!(Eval_Signals & Eval_Sigmask)) return;
@@ -777,7 +854,7 @@ more_path:
 	// Check for recycle signal:
 	if (GET_FLAG(sigs, SIG_RECYCLE)) {
 		CLR_SIGNAL(SIG_RECYCLE);
-		Recycle();
+		Recycle_Auto();
 	}
 
 #ifdef NOT_USED_INVESTIGATE
@@ -798,6 +875,31 @@ more_path:
 }
 
 
+/***********************************************************************
+**
+*/	static REBFLG Tail_Callable(REBVAL *func)
+/*
+**		Return TRUE if the frame of the running function may be
+**		replaced by the frame of a function it calls in tail position.
+**
+**		That is so for a CLOSURE!, as its words are bound to a frame
+**		of its own, and for a call of a FUNCTION! to itself, as its
+**		relative words then find the new frame as the newest one.
+**		Any other function might still refer to the running frame,
+**		such as by a FUNC made in the body and passed to it.
+**
+***********************************************************************/
+{
+	REBINT dsf;
+
+	// Skip natives called in tail position (see DO_TAIL_BLK):
+	for (dsf = DSF; DSF_ACTIVE(dsf) == DSF_TAIL; dsf = PRIOR_DSF(dsf));
+
+	return IS_CLOSURE(DSF_FUNC(dsf))
+		|| VAL_FUNC_ARGS(DSF_FUNC(dsf)) == VAL_FUNC_ARGS(func);
+}
+
+
 /***********************************************************************
 **
 */	REBCNT Do_Next(REBSER *block, REBCNT index, REBFLG op)
@@ -815,8 +917,15 @@ more_path:
 {
 	REBVAL *value;
 	REBVAL *word = 0;
+	REBVAL *arg;
 	REBINT ftype;
 	REBCNT dsf;
+	REBSER *code;
+	REBCOD *cell;
+	REBCNT argc;
+	REBFLG tail;
+
+	if ((tail = Eval_Tail)) Eval_Tail = FALSE; // (see Do_Tail_Blk)
 
 	//CHECK_MEMORY(1);
 	CHECK_STACK(&value);
@@ -826,6 +935,39 @@ more_path:
 	value = BLK_SKIP(block, index);
 	//if (Trace_Flags) Trace_Eval(block, index);
 
+	// Use the pre-decoded code cells of the block, if it has them:
+	if (!Trace_Flags && (code = BLK_CODE(block))) {
+		cell = CODE_SKIP(code, index);
+		if (cell->kind & CODE_INERT) {
+			// Evaluates to itself, and no infix op can follow:
+			if ((op || (cell->kind & CODE_LAST)) && EVAL_TYPE(value) == ET_SELF) {
+				DS_PUSH(value);
+				return index + 1;
+			}
+		}
+		else if ((cell->kind & CODE_WORD) && IS_WORD(value)) {
+			value = Get_Var(word = value);
+			if (VAL_TYPE(value) < REB_NATIVE) {
+				// A variable, and no infix op can follow:
+				if ((op || (cell->kind & CODE_LAST)) && VAL_TYPE(value) > REB_UNSET && !IS_LIT_WORD(value)) {
+					DS_PUSH(value);
+					return index + 1;
+				}
+			}
+			// A call site of a known function, with a plan for its args:
+			else if (cell->args == VAL_FUNC_ARGS(value) && cell->argc != NO_PLAN
+				&& VAL_TYPE(value) <= REB_FUNCTION && !IS_OP(value)) {
+				argc = cell->argc; // (cell may be dropped by arg evaluation)
+				ftype = VAL_TYPE(value) - REB_NATIVE;
+				dsf = Push_Func(FALSE, block, index, VAL_WORD_SYM(word), value);
+				index = Do_Plan_Args(VAL_FUNC_WORDS(value), argc, block, index+1, FALSE);
+				value = DSF_FUNC(dsf);
+				goto eval_func2;
+			}
+			goto eval_var; // evaluate it the normal way (as fetched)
+		}
+	}
+
 reval:
 	if (Trace_Flags) Trace_Line(block, index, value);
 
@@ -834,11 +976,18 @@ reval:
 
 	case ET_WORD:
 		value = Get_Var(word = value);
+eval_var:
 		if (IS_UNSET(value)) Trap1(RE_NO_VALUE, word);
-		if (VAL_TYPE(value) >= REB_NATIVE && VAL_TYPE(value) <= REB_FUNCTION) goto reval; // || IS_LIT_PATH(value)
+		if (VAL_TYPE(value) >= REB_NATIVE && VAL_TYPE(value) <= REB_FUNCTION) {
+			// Remember the function called from this code cell:
+			if (!Trace_Flags && (code = BLK_CODE(block))
+				&& CODE_SKIP(code, index)->args != VAL_FUNC_ARGS(value))
+				Plan_Call(block, CODE_SKIP(code, index), value);
+			goto reval; // || IS_LIT_PATH(value)
+		}
 		DS_PUSH(value);
 		if (IS_LIT_WORD(value)) VAL_SET(DS_TOP, REB_WORD);
-		if (IS_FRAME(value)) Init_Obj_Value(DS_TOP, VAL_WORD_FRAME(word));
+		if (IS_FRAME(value)) Init_Obj_Value(DS_TOP, Word_Frame(word));
 		index++;
 		break;
 
@@ -853,6 +1002,7 @@ reval:
 		index = Do_Next(block, index+1, 0);
 		// THROWN is handled in Set_Var.
 		if (index == END_FLAG || VAL_TYPE(DS_TOP) <= REB_UNSET) Trap1(RE_NEED_VALUE, word);
+		if (VAL_GET_OPT(DS_TOP, OPTS_SHARE)) Unshare_Value(DS_TOP);
 		Set_Var(word, DS_TOP);
 		//Set_Word(word, DS_TOP); // (value stays on stack)
 		//Dump_Frame(Main_Frame);
@@ -871,6 +1021,18 @@ eval_func:
 		}
 		index = Do_Args(value, 0, block, index+1); // uses old DSF, updates DSP
 eval_func2:
+		// A call that ends the body of a function is a tail call:
+		if (tail && index >= BLK_LEN(block) && !THROWN(DS_TOP) && !Trace_Flags) {
+			if ((ftype == REB_FUNCTION - REB_NATIVE || ftype == REB_CLOSURE - REB_NATIVE)
+				&& Tail_Callable(value)) {
+				// Its frame will replace the current one (see Do_Body):
+				SET_THROW(DS_VALUE(dsf), RE_TAIL_CALL, DS_VALUE(dsf));
+				DSP = dsf;
+				return index;
+			}
+			if (ftype == REB_NATIVE - REB_NATIVE) DSF_ACTIVE(dsf) = DSF_TAIL;
+		}
+
 		// Evaluate the function:
 		DSF = dsf;	// Set new DSF
 		if (!THROWN(DS_TOP)) {
@@ -902,9 +1064,25 @@ eval_func2:
 		// datatype is stored in the extended flags part of the value.
 		if (!word) word = ROOT_NONAME;
 		if (DSP <= 0 || index == 0) Trap1(RE_NO_OP_ARG, word);
+		// Integer and decimal math of a stock op needs no frame:
+		if ((IS_INTEGER(DS_TOP) || IS_DECIMAL(DS_TOP)) && !Trace_Flags) {
+			arg = BLK_SKIP(block, index+1);
+			if (IS_WORD(arg) && VAL_WORD_FRAME(arg)) arg = Get_Var(arg);
+			if ((IS_INTEGER(arg) || IS_DECIMAL(arg)) && Do_Math_Op(value, DS_TOP, arg)) {
+				index += 2;
+				break;
+			}
+		}
 		ftype = VAL_GET_EXT(value) - REB_NATIVE;
 		dsf = Push_Func(TRUE, block, index, VAL_WORD_SYM(word), value); // TOS has first arg
 		DS_PUSH(DS_VALUE(dsf)); // Copy prior to first argument
+		// Use the plan of its code cell, if it has one:
+		if (!Trace_Flags && (code = BLK_CODE(block)) && (cell = CODE_SKIP(code, index))->argc != NO_PLAN
+			&& cell->args == VAL_FUNC_ARGS(value)) {
+			index = Do_Plan_Args(VAL_FUNC_WORDS(value), cell->argc, block, index+1, TRUE);
+			value = DSF_FUNC(dsf);
+			goto eval_func2;
+		}
 		goto eval_func;
 
 	case ET_PATH:  // PATH, SET_PATH
@@ -917,6 +1095,7 @@ eval_func2:
 			index = Do_Next(block, index+1, 0);
 			// THROWN is handled in Do_Path.
 			if (index == END_FLAG || VAL_TYPE(DS_TOP) <= REB_UNSET) Trap1(RE_NEED_VALUE, word);
+			if (VAL_GET_OPT(DS_TOP, OPTS_SHARE)) Unshare_Value(DS_TOP);
 			Do_Path(&word, DS_TOP);
 		} else {
 			// Can be a path or get-path:
@@ -945,6 +1124,7 @@ eval_func2:
 	case ET_LIT_WORD:
 		DS_PUSH(value);
 		VAL_SET(DS_TOP, REB_WORD);
+		if (VAL_WORD_INDEX(DS_TOP) < 0) Unshare_Value(DS_TOP);
 		index++;
 		break;
 
@@ -956,6 +1136,7 @@ eval_func2:
 	case ET_LIT_PATH:
 		DS_PUSH(value);
 		VAL_SET(DS_TOP, REB_PATH);
+		if (VAL_GET_OPT(value, OPTS_SHARE)) Unshare_Value(DS_TOP);
 		index++;
 		break;
 
@@ -971,8 +1152,29 @@ eval_func2:
 	// If normal eval (not higher precedence of infix op), check for op:
 	if (!op) {
 		value = BLK_SKIP(block, index);
-		if (IS_WORD(value) && VAL_WORD_FRAME(value) && IS_OP(Get_Var(value)))
+		if (IS_WORD(value) && VAL_WORD_FRAME(value)) {
+			if (Trace_Flags) {
+				if (IS_OP(Get_Var(value))) goto reval;
+				return index;
+			}
+			// A code cell remembers words that were found not to be ops:
+			if (NZ(code = BLK_CODE(block))) {
+				if (code->size != Op_Epoch) Reset_Op_Cells(code);
+				cell = CODE_SKIP(code, index);
+				if (cell->kind & CODE_NOT_OP) return index;
+			}
+			value = Get_Var(word = value);
+			if (!IS_OP(value)) {
+				// (Not for args, but for the fields of a method, see Share_Methods)
+				if (code && (VAL_WORD_INDEX(word) > 0
+					|| -VAL_WORD_INDEX(word) >= (REBINT)SERIES_TAIL(VAL_WORD_FRAME(word))))
+					cell->kind |= CODE_NOT_OP;
+				return index;
+			}
+			// Evaluate the op without fetching it again:
+			if (code && cell->args != VAL_FUNC_ARGS(value)) Plan_Call(block, cell, value);
 			goto reval;
+		}
 	}
 
 	return index;
@@ -1017,6 +1219,89 @@ eval_func2:
 }
 
 
+/***********************************************************************
+**
+*/	REBVAL *Do_Tail_Blk(REBSER *block, REBCNT index)
+/*
+**		Evaluate a block whose result is the result of the current
+**		function: its body, or the block of a native like EITHER
+**		that was called in tail position of it (see DO_TAIL_BLK).
+**
+**		A FUNCTION! or CLOSURE! call that ends the block is not done
+**		here. Its frame is left above the stack and a TAIL_CALL throw
+**		is returned for Do_Body to reuse the current frame.
+**
+***********************************************************************/
+{
+	REBVAL *tos = 0;
+	REBINT start = DSP;
+
+	ASSERT1(block->info, RP_GC_OF_BLOCK);
+
+	while (index < BLK_LEN(block)) {
+		Eval_Tail = TRUE;
+		index = Do_Next(block, index, 0);
+		tos = DS_POP;
+		if (THROWN(tos)) break;
+	}
+	// If block was empty:
+	if (!tos) {tos = DS_NEXT; SET_UNSET(tos);}
+
+	if (start != DSP || tos != &DS_Base[start+1]) Trap0(RE_MISSING_ARG);
+
+	return tos;
+}
+
+
+/***********************************************************************
+**
+*/	void Compile_Block(REBSER *block, REBCNT depth)
+/*
+**		Pre-decode a block that will be evaluated many times (a
+**		function body) into code cells, one per value, kept in the
+**		block's series header. Do_Next uses them to push simple
+**		values without its dispatch and infix op checks, and to
+**		gather the args of a known function by a plan rather than
+**		thru Do_Args (see Plan_Call).
+**
+**		Nested blocks and parens are compiled too, down to depth.
+**		The cells are dropped when the block is modified.
+**
+***********************************************************************/
+{
+	REBSER *code;
+	REBCOD *cell;
+	REBVAL *value;
+	REBCNT words = 0;
+
+	// Already compiled, or has a side series of its own (MAP):
+	if (BLK_CODE(block) || (block->series && !IS_CODE_SERIES(block->series))) return;
+
+	for (value = BLK_HEAD(block); NOT_END(value); value++) {
+		if (IS_WORD(value)) words++;
+		else if ((IS_BLOCK(value) || IS_PAREN(value)) && depth > 1)
+			Compile_Block(VAL_SERIES(value), depth - 1);
+	}
+
+	// Nested blocks without words are data, not code:
+	if (!words && depth < CODE_DEPTH) return;
+
+	code = Make_Series(SERIES_TAIL(block) + 1, sizeof(REBCOD), FALSE);
+	CLEAR_SERIES(code);
+	code->tail = SERIES_TAIL(block);
+
+	cell = CODE_SKIP(code, 0);
+	for (value = BLK_HEAD(block); NOT_END(value); value++, cell++) {
+		if (EVAL_TYPE(value) == ET_SELF) cell->kind = CODE_INERT;
+		else if (IS_WORD(value)) cell->kind = CODE_WORD;
+		if (!IS_WORD(value+1)) cell->kind |= CODE_LAST;
+	}
+
+	block->series = code;
+	REMEMBER_SERIES(block);
+}
+
+
 /***********************************************************************
 **
 */	REBVAL *Do_Block_Value_Throw(REBVAL *block)
@@ -1094,6 +1379,7 @@ eval_func2:
 	while (index < BLK_LEN(block)) {
 		index = Do_Next(block, index, 0);
 		if (THROWN(DS_TOP)) return;
+		UNSHARE(DS_TOP);
 	}
 
 	Copy_Stack_Values(start, into);
@@ -1124,6 +1410,7 @@ eval_func2:
 			// Check for keyword:
 			if (ser && NOT_FOUND != Find_Word(ser, idx, VAL_WORD_CANON(val))) {
 				DS_PUSH(val);
+				UNSHARE(DS_TOP);
 				continue;
 			}
 			v = Get_Var(val);
@@ -1136,6 +1423,7 @@ eval_func2:
 				if (IS_WORD(v)) {
 					if (NOT_FOUND != Find_Word(ser, idx, VAL_WORD_CANON(v))) {
 						DS_PUSH(val);
+						UNSHARE(DS_TOP);
 						continue;
 					}
 				}
@@ -1143,7 +1431,10 @@ eval_func2:
 			v = val;
 			Do_Path(&v, 0); // pushes val on stack
 		}
-		else DS_PUSH(val);
+		else {
+			DS_PUSH(val);
+			UNSHARE(DS_TOP);
+		}
 		// No need to check for unwinds (THROWN) here, because unwinds should
 		// never be accessible via words or paths.
 	}
@@ -1168,6 +1459,7 @@ eval_func2:
 		} else
 			index = Do_Next(block, index, 0);
 		if (THROWN(DS_TOP)) return;
+		UNSHARE(DS_TOP);
 	}
 
 	Copy_Stack_Values(start, into);
@@ -1593,6 +1885,8 @@ eval_func2:
 **
 ***********************************************************************/
 {
+	UNCOMPILE_BLOCK(VAL_SERIES(block));
+	REMEMBER_SERIES(VAL_SERIES(block));
 	Bind_Block(frame, VAL_BLK_DATA(block), BIND_DEEP);
 	return DO_BLK(block);
 }
@@ -1607,6 +1901,8 @@ eval_func2:
 **
 ***********************************************************************/
 {
+	UNCOMPILE_BLOCK(VAL_SERIES(block));
+	REMEMBER_SERIES(VAL_SERIES(block));
 	Bind_Block(frame, VAL_BLK_DATA(block), binding);
 	Reduce_Block(VAL_SERIES(block), VAL_INDEX(block), 0);
 }
@@ -88,6 +88,8 @@
 
 #define CHECK_BIND_TABLE
 
+static void Bind_Block_Words(REBSER *frame, REBFLG hashed, REBVAL *value, REBCNT mode);
+
 /***********************************************************************
 **
 */	void Check_Bind_Table()
@@ -95,14 +97,144 @@
 ***********************************************************************/
 {
 	REBCNT	n;
-	REBINT *binds = WORDS_HEAD(Bind_Table);
+	REBCNT	count = 0;
+	REBBND *binds = BIND_SLOTS(Bind_Table);
 
 	//Debug_Fmt("Bind Table (Size: %d)", SERIES_TAIL(Bind_Table));
 	for (n = 0; n < SERIES_TAIL(Bind_Table); n++) {
-		if (binds[n]) {
-			Debug_Fmt("Bind table fault: %3d to %3d (%s)", n, binds[n], Get_Sym_Name(n));
+		if (binds[n].mark == Bind_Mark) count++;
+		else if (binds[n].mark > Bind_Mark) {
+			Debug_Fmt((REBYTE*)"Bind table fault: %3d marked %d (%s)", n, binds[n].mark, Get_Sym_Name(binds[n].canon));
+		}
+	}
+	if (count != Bind_Count || 2 * count > SERIES_TAIL(Bind_Table))
+		Debug_Fmt((REBYTE*)"Bind table fault: %d entries, %d counted", count, Bind_Count);
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Make_Bind_Table(REBCNT size)
+/*
+***********************************************************************/
+{
+	REBSER *table = Make_Series(size, sizeof(REBBND), FALSE);
+
+	KEEP_SERIES(table, "bind table");
+	CLEAR(BIND_SLOTS(table), size * sizeof(REBBND));
+	table->tail = size;
+
+	return table;
+}
+
+
+/***********************************************************************
+**
+*/	void Reset_Bind_Table(void)
+/*
+**		Empty the bind table for a new bind. The entries of the
+**		last bind are left, but no longer have the current mark.
+**		A table expanded for a large bind is made small again when
+**		it is not needed, to keep the lookups within the cache.
+**
+***********************************************************************/
+{
+	if (SERIES_TAIL(Bind_Table) > BIND_TABLE_SIZE && Bind_Count < BIND_TABLE_SIZE / 4) {
+		Free_Series(Bind_Table);
+		Bind_Table = Make_Bind_Table(BIND_TABLE_SIZE);
+	}
+
+	if (!++Bind_Mark) {
+		CLEAR(BIND_SLOTS(Bind_Table), SERIES_TAIL(Bind_Table) * sizeof(REBBND));
+		Bind_Mark = 1;
+	}
+	Bind_Count = 0;
+}
+
+
+/***********************************************************************
+**
+*/	static void Expand_Bind_Table(REBCNT canon, REBINT index)
+/*
+**		Double the size of the bind table, keeping the entries of
+**		the current bind, and add the new entry to it.
+**
+***********************************************************************/
+{
+	REBSER *table = Bind_Table;
+	REBBND *old = BIND_SLOTS(table);
+	REBBND *binds;
+	REBCNT size = 2 * SERIES_TAIL(table);
+	REBCNT n;
+	REBCNT i;
+
+	Bind_Table = Make_Bind_Table(size);
+	binds = BIND_SLOTS(Bind_Table);
+	for (n = 0; n < SERIES_TAIL(table); n++) {
+		if (old[n].mark != Bind_Mark) continue;
+		for (i = (old[n].canon * WORD_HASH_MUL) & (size - 1); binds[i].mark; i = (i + 1) & (size - 1));
+		binds[i] = old[n];
+	}
+	for (i = (canon * WORD_HASH_MUL) & (size - 1); binds[i].mark; i = (i + 1) & (size - 1));
+	binds[i].canon = canon;
+	binds[i].index = index;
+	binds[i].mark = Bind_Mark;
+	Bind_Count++;
+
+	Free_Series(table);
+}
+
+
+/***********************************************************************
+**
+*/	REBINT Get_Bind(REBCNT canon)
+/*
+**		Return the frame index of a word in the current bind, or
+**		zero if it has none.
+**
+***********************************************************************/
+{
+	REBBND *binds = BIND_SLOTS(Bind_Table);
+	REBCNT mask = SERIES_TAIL(Bind_Table) - 1;
+	REBCNT n;
+
+	for (n = (canon * WORD_HASH_MUL) & mask; binds[n].mark == Bind_Mark; n = (n + 1) & mask)
+		if (binds[n].canon == canon) return binds[n].index;
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	void Set_Bind(REBCNT canon, REBINT index)
+/*
+**		Set the frame index of a word in the current bind (zero
+**		to remove it). The table is expanded when half full.
+**
+***********************************************************************/
+{
+	REBBND *binds = BIND_SLOTS(Bind_Table);
+	REBCNT mask = SERIES_TAIL(Bind_Table) - 1;
+	REBCNT n;
+
+	for (n = (canon * WORD_HASH_MUL) & mask; binds[n].mark == Bind_Mark; n = (n + 1) & mask) {
+		if (binds[n].canon == canon) {
+			binds[n].index = index;
+			return;
 		}
 	}
+	if (!index) return;
+
+	if (2 * (Bind_Count + 1) > SERIES_TAIL(Bind_Table)) {
+		Expand_Bind_Table(canon, index);
+		return;
+	}
+
+	binds[n].canon = canon;
+	binds[n].index = index;
+	binds[n].mark = Bind_Mark;
+	Bind_Count++;
 }
 
 /***********************************************************************
@@ -148,10 +280,15 @@
 	Extend_Series(frame, delta);
 	BLK_TERM(frame);
 
-	// Expand or copy WORDS block:
+	// Expand or copy WORDS block (and its hash, see Find_Word_Index):
 	if (copy) {
 		FRM_WORD_SERIES(frame) = Copy_Expand_Block(words, delta);
 		BARE_SERIES(FRM_WORD_SERIES(frame));
+		if (IS_WORD_HASH(words->series)) {
+			FRM_WORD_SERIES(frame)->series = Copy_Series(words->series);
+			SIDE_KIND(FRM_WORD_SERIES(frame)->series) = SIDE_WORDS;
+			REMEMBER_SERIES(FRM_WORD_SERIES(frame));
+		}
 	} else {
 		Extend_Series(words, delta);
 		BLK_TERM(words);
@@ -191,6 +328,9 @@
 		VAL_WORD_INDEX(word) = frame->tail;
 	}
 
+	// Keep the word hash of a large frame:
+	if (IS_WORD_HASH(words->series)) Hash_Frame_Words(words);
+
 	// Add unset value to frame:
 	EXPAND_SERIES_TAIL(frame, 1);
 	word = BLK_LAST(frame);
@@ -213,17 +353,17 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
-
 	CHECK_BIND_TABLE;
 
+	Reset_Bind_Table();
+
 	// Reuse a global word list block because length of block cannot
 	// be known until all words are scanned. Then copy this block.
 	if (SERIES_TAIL(BUF_WORDS)) Crash(RP_WORD_LIST); // still in use
 
 	// Add the SELF word to slot zero.
 	if ((modes = (modes & BIND_NO_SELF)?0:SYM_SELF))
-		binds[modes] = -1;  // (cannot use zero here)
+		Set_Bind(modes, -1);  // (cannot use zero here)
 	Init_Frame_Word(BLK_HEAD(BUF_WORDS), modes);
 	SERIES_TAIL(BUF_WORDS) = 1;
 }
@@ -233,17 +373,11 @@
 **
 */  REBSER *Collect_End(REBSER *prior)
 /*
-**		Finish collecting words, and free the Bind_Table for reuse.
+**		Finish collecting words. The Bind_Table still holds them,
+**		until the next bind (see Make_Bound_Object).
 **
 ***********************************************************************/
 {
-	REBVAL *words;
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
-
-	// Reset binding table (note BUF_WORDS may have expanded):
-	for (words = BLK_HEAD(BUF_WORDS); NOT_END(words); words++)
-		binds[VAL_WORD_CANON(words)] = 0;
-
 	// If no new words, prior frame:
 	if (prior && SERIES_TAIL(BUF_WORDS) == SERIES_TAIL(prior)) {
 		RESET_TAIL(BUF_WORDS);  // allow reuse
@@ -269,7 +403,6 @@
 ***********************************************************************/
 {
 	REBVAL *words = FRM_WORDS(prior);
-	REBINT *binds = WORDS_HEAD(Bind_Table);
 	REBINT n;
 
 	// this is necessary for COPY_VALUES below
@@ -278,7 +411,7 @@
 	COPY_VALUES(words, BLK_HEAD(BUF_WORDS), SERIES_TAIL(prior));
 	SERIES_TAIL(BUF_WORDS) = SERIES_TAIL(prior);
 	for (n = 1, words++; NOT_END(words); words++) // skips first = SELF
-		binds[VAL_WORD_CANON(words)] = n++;
+		Set_Bind(VAL_WORD_CANON(words), n++);
 }
 
 
@@ -290,7 +423,6 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds = WORDS_HEAD(Bind_Table);
 	REBVAL *word;
 	REBVAL *value;
 
@@ -298,9 +430,9 @@
 		value = block;
 		//if (modes & BIND_GET && IS_GET_WORD(block)) value = Get_Var(block);
 		if (ANY_WORD(value)) {
-			if (!binds[VAL_WORD_CANON(value)]) {  // only once per word
+			if (!Get_Bind(VAL_WORD_CANON(value))) {  // only once per word
 				if (IS_SET_WORD(value) || modes & BIND_ALL) {
-					binds[VAL_WORD_CANON(value)] = SERIES_TAIL(BUF_WORDS);
+					Set_Bind(VAL_WORD_CANON(value), SERIES_TAIL(BUF_WORDS));
 					EXPAND_SERIES_TAIL(BUF_WORDS, 1);
 					word = BLK_LAST(BUF_WORDS);
 					VAL_SET(word, VAL_TYPE(value));
@@ -312,9 +444,6 @@
 			} else {
 				// If word duplicated:
 				if (modes & BIND_NO_DUP) {
-					// Reset binding table (note BUF_WORDS may have expanded):
-					for (word = BLK_HEAD(BUF_WORDS); NOT_END(word); word++)
-						binds[VAL_WORD_CANON(word)] = 0;
 					RESET_TAIL(BUF_WORDS);  // allow reuse
 					Trap1(RE_DUP_VARS, value);
 				}
@@ -371,15 +500,14 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
 	REBVAL *val;
 
 	for (; NOT_END(block); block++) {
 		if (ANY_WORD(block)
-			&& !binds[VAL_WORD_CANON(block)]
+			&& !Get_Bind(VAL_WORD_CANON(block))
 			&& (modes & BIND_ALL || IS_SET_WORD(block))
 		) {
-			binds[VAL_WORD_CANON(block)] = 1;
+			Set_Bind(VAL_WORD_CANON(block), 1);
 			val = Append_Value(BUF_WORDS);
 			Init_Word(val, VAL_WORD_SYM(block));
 		}
@@ -399,10 +527,10 @@
 {
 	REBSER *series;
 	REBCNT start;
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
 	CHECK_BIND_TABLE;
 
 	if (SERIES_TAIL(BUF_WORDS)) Crash(RP_WORD_LIST); // still in use
+	Reset_Bind_Table();
 
 	if (prior)
 		Collect_Simple_Words(prior, BIND_ALL);
@@ -410,10 +538,6 @@
 	start = SERIES_TAIL(BUF_WORDS);
 	Collect_Simple_Words(block, modes);
 
-	// Reset word markers:
-	for (block = BLK_HEAD(BUF_WORDS); NOT_END(block); block++)
-		binds[VAL_WORD_CANON(block)] = 0;
-
 	series = Copy_Series_Part(BUF_WORDS, start, SERIES_TAIL(BUF_WORDS)-start);
 	RESET_TAIL(BUF_WORDS);  // allow reuse
 
@@ -461,11 +585,44 @@
 
 /***********************************************************************
 **
-*/  REBSER *Make_Object(REBSER *parent, REBVAL *block)
+*/  void Share_Methods(REBSER *parent, REBSER *object)
+/*
+**      Give a new object, with the values of its parent copied into
+**      it, the methods of the parent as its own. The functions of the
+**      parent are made methods first, so the objects made from it
+**      share their bodies (see Make_Method). Methods of some other
+**      object are left as they are.
+**
+**      An op! copied from the parent voids the CODE_NOT_OP cells, as
+**      those of a shared body may be of words of other objects.
+**
+***********************************************************************/
+{
+	REBVAL *val = FRM_VALUES(parent) + 1;
+	REBVAL *obj = FRM_VALUES(object) + 1;
+
+	for (; NOT_END(val); val++, obj++) {
+		NOTE_OP_SET(val);
+		if (!IS_FUNCTION(val)) continue;
+		if (!IS_METHOD(val) && !Make_Method(val, parent)) continue;
+		if (VAL_METHOD_SELF(val) != parent) continue;
+		*obj = *val;
+		VAL_METHOD_SELF(obj) = object;
+	}
+}
+
+
+/***********************************************************************
+**
+*/  REBSER *Make_Object(REBSER *parent, REBVAL *block, REBFLG share)
 /*
 **      Create an object from a parent object and a spec block.
 **		The words within the resultant object are not bound.
 **
+**		If share, the object shares the methods of the parent (see
+**		Share_Methods), for MAKE, which rebinds it. Else its functions
+**		are copies, still bound to the parent.
+**
 ***********************************************************************/
 {
 	REBSER *words;
@@ -474,7 +631,12 @@
 	PG_Reb_Stats->Objects++;
 
 	if (!block || IS_END(block)) {
-		object = parent ? Copy_Block_Values(parent, 0, SERIES_TAIL(parent), TS_CLONE) : Make_Frame(0);
+		if (parent) {
+			object = Copy_Block_Values(parent, 0, SERIES_TAIL(parent), 0);
+			if (share) Share_Methods(parent, object);
+			Copy_Deep_Values(object, 1, SERIES_TAIL(object), TS_CLONE);
+		}
+		else object = Make_Frame(0);
 	} else {
 		words = Collect_Frame(BIND_ONLY, parent, block); // GC safe
 		object = Create_Frame(words, 0); // GC safe
@@ -483,6 +645,7 @@
 				Debug_Fmt(BOOT_STR(RS_WATCH, 2), SERIES_TAIL(parent) - 1, FRM_WORD_SERIES(object));
 			// Copy parent values and deep copy blocks and strings:
 			COPY_VALUES(FRM_VALUES(parent)+1, FRM_VALUES(object)+1, SERIES_TAIL(parent) - 1);
+			if (share) Share_Methods(parent, object);
 			Copy_Deep_Values(object, 1, SERIES_TAIL(object), TS_CLONE);
 		}
 	}
@@ -492,6 +655,42 @@
 }
 
 
+/***********************************************************************
+**
+*/  REBSER *Make_Bound_Object(REBSER *parent, REBVAL *block, REBCNT mode, REBFLG share)
+/*
+**      Make_Object, then bind the block to the object (as by
+**      Bind_Block with the mode given). The words collected for the
+**      object are still in the Bind_Table, so are used for the bind
+**      as they are, unless a bind was done in between.
+**
+***********************************************************************/
+{
+	REBSER *object;
+	REBVAL *word;
+	REBCNT mark = Bind_Mark;
+
+	object = Make_Object(parent, block, share);
+	if (!block || IS_END(block)) return object;
+
+	if (Bind_Mark != mark + 1) {
+		Bind_Block(object, block, mode);
+		return object;
+	}
+
+	// Hidden words of the parent are not bound (nor SELF if it has none):
+	if (parent) {
+		for (word = FRM_WORDS(parent) + 1; NOT_END(word); word++)
+			if (VAL_GET_OPT(word, OPTS_HIDE)) Set_Bind(VAL_BIND_CANON(word), 0);
+		if (IS_SELFLESS(object) && Get_Bind(SYM_SELF) < 0) Set_Bind(SYM_SELF, 0);
+	}
+
+	Bind_Block_Words(object, FALSE, block, mode);
+
+	return object;
+}
+
+
 /***********************************************************************
 **
 */  REBSER *Construct_Object(REBSER *parent, REBVAL *block, REBFLG asis)
@@ -503,8 +702,7 @@
 {
 	REBSER *frame;
 
-	frame = Make_Object(parent, block);
-	if (NOT_END(block)) Bind_Block(frame, block, BIND_ONLY);
+	frame = Make_Bound_Object(parent, block, BIND_ONLY, FALSE);
 	if (asis) Do_Min_Construct(block);
 	else Do_Construct(block);
 	return frame;
@@ -603,7 +801,10 @@
 
 	// Build standard module header object:
 	obj = VAL_OBJ_FRAME(Get_System(SYS_STANDARD, STD_SCRIPT));
-	if (block && IS_BLOCK(block)) frame = Construct_Object(obj, VAL_BLK_DATA(block), 0);
+	if (block && IS_BLOCK(block)) {
+		REMEMBER_SERIES(VAL_SERIES(block)); // rebound
+		frame = Construct_Object(obj, VAL_BLK_DATA(block), 0);
+	}
 	else frame = CLONE_OBJECT(obj);
 
 	return frame;
@@ -626,7 +827,7 @@
 	REBVAL *words;
 	REBVAL *value;
 	REBCNT n;
-	REBINT *binds = WORDS_HEAD(Bind_Table);
+	REBCNT mark;
 
 	// Merge parent1 and parent2 words.
 	// Keep the binding table.
@@ -635,6 +836,7 @@
 	if (parent1) Collect_Object(parent1);
 	// Add parent2 words to binding table and BUF_WORDS:
 	Collect_Words(BLK_SKIP(FRM_WORD_SERIES(parent2), 1), BIND_ALL);
+	mark = Bind_Mark;
 
 	// Allocate child (now that we know the correct size):
 	wrds = Copy_Series(BUF_WORDS);
@@ -652,7 +854,7 @@
 	value = FRM_VALUES(parent2)+1;
 	for (; NOT_END(words); words++, value++) {
 		// no need to search when the binding table is available
-		n = binds[VAL_WORD_CANON(words)];
+		n = Get_Bind(VAL_WORD_CANON(words));
 		BLK_HEAD(child)[n] = *value;
 	}
 
@@ -663,6 +865,13 @@
 	// Deep copy the child
 	Copy_Deep_Values(child, 1, SERIES_TAIL(child), TS_CLONE);
 
+	// The table is needed again below (if a copy was bound, set it up):
+	if (Bind_Mark != mark) {
+		Reset_Bind_Table();
+		for (n = 1, words = BLK_SKIP(wrds, 1); NOT_END(words); n++, words++)
+			Set_Bind(VAL_BIND_CANON(words), n);
+	}
+
 	// Rebind the child
 	Rebind_Block(parent1, child, BLK_SKIP(child, 1), REBIND_FUNC);
 	Rebind_Block(parent2, child, BLK_SKIP(child, 1), REBIND_FUNC | REBIND_TABLE);
@@ -683,7 +892,6 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds  = WORDS_HEAD(Bind_Table); // GC safe to do here
 	REBVAL *words;
 	REBVAL *vals;
 	REBINT n;
@@ -708,14 +916,14 @@
 	if (i) {
 		// Only the new words of the target:
 		for (words = FRM_WORD(target, i); NOT_END(words); words++)
-			binds[VAL_BIND_CANON(words)] = -1;
+			Set_Bind(VAL_BIND_CANON(words), -1);
 		n = SERIES_TAIL(target) - 1;
 	}
 	else if (IS_BLOCK(only_words)) {
 		// Limit exports to only these words:
 		for (words = VAL_BLK_DATA(only_words); NOT_END(words); words++) {
 			if (IS_WORD(words) || IS_SET_WORD(words)) {
-				binds[VAL_WORD_CANON(words)] = -1;
+				Set_Bind(VAL_WORD_CANON(words), -1);
 				n++;
 			}
 		}
@@ -725,29 +933,43 @@
 	if (expand && n > 0) {
 		// Determine how many new words to add:
 		for (words = FRM_WORD(target, 1); NOT_END(words); words++)
-			if (binds[VAL_BIND_CANON(words)]) n--;
+			if (Get_Bind(VAL_BIND_CANON(words))) n--;
 		// Expand frame by the amount required:
 		if (n > 0) Expand_Frame(target, n, 0);
 		else expand = 0;
 	}
 
 	// Maps a word to its value index in the source context.
-	// Done by marking all source words (in bind table):
-	words = FRM_WORDS(source)+1;
-	for (n = 1; NOT_END(words); n++, words++) {
-		if (IS_NONE(only_words) || binds[VAL_BIND_CANON(words)])
-			binds[VAL_WORD_CANON(words)] = n;
+	// Done by marking all source words (in bind table), or for
+	// a few words of a large source, by finding each of them:
+	if (!IS_NONE(only_words) && SERIES_TAIL(FRM_WORD_SERIES(source)) > WORD_HASH_MIN) {
+		words = i ? FRM_WORD(target, i) : VAL_BLK_DATA(only_words);
+		for (; NOT_END(words); words++) {
+			if (!i && !IS_WORD(words) && !IS_SET_WORD(words)) continue;
+			if ((m = Find_Word_Index(source, VAL_WORD_SYM(words), TRUE)))
+				Set_Bind(VAL_WORD_CANON(words), m);
+		}
+	}
+	else {
+		words = FRM_WORDS(source)+1;
+		for (n = 1; NOT_END(words); n++, words++) {
+			if (IS_NONE(only_words) || Get_Bind(VAL_BIND_CANON(words)))
+				Set_Bind(VAL_BIND_CANON(words), n);
+		}
 	}
 
 	// Foreach word in target, copy the correct value from source:
 	n = i ? i : 1;
 	vals = FRM_VALUE(target, n);
 	for (words = FRM_WORD(target, n); NOT_END(words); words++, vals++) {
-		if ((m = binds[VAL_BIND_CANON(words)])) {
-			binds[VAL_BIND_CANON(words)] = 0; // mark it as set
+		if ((m = Get_Bind(VAL_BIND_CANON(words)))) {
+			Set_Bind(VAL_BIND_CANON(words), 0); // mark it as set
 			if (!VAL_PROTECTED(words) && (all || IS_UNSET(vals))) {
 				if (m < 0) SET_UNSET(vals); // no value in source context
-				else *vals = *FRM_VALUE(source, m);
+				else {
+					*vals = *FRM_VALUE(source, m);
+					NOTE_OP_SET(vals);
+				}
 				//Debug_Num("type:", VAL_TYPE(vals));
 				//Debug_Str(Get_Word_Name(words));
 			}
@@ -759,30 +981,15 @@
 		REBVAL *val;
 		words = FRM_WORDS(source)+1;
 		for (n = 1; NOT_END(words); n++, words++) {
-			if (binds[VAL_BIND_CANON(words)]) {
+			if (Get_Bind(VAL_BIND_CANON(words))) {
 				// Note: no protect check is needed here
-				binds[VAL_BIND_CANON(words)] = 0;
+				Set_Bind(VAL_BIND_CANON(words), 0);
 				val = Append_Frame(target, 0, VAL_BIND_SYM(words));
 				*val = *FRM_VALUE(source, n);
+				NOTE_OP_SET(val);
 			}
 		}
 	}
-	else {
-		// Reset bind table (do not use Collect_End):
-		if (i) {
-			for (words = FRM_WORD(target, i); NOT_END(words); words++)
-				binds[VAL_BIND_CANON(words)] = 0;
-		}
-		else if (IS_BLOCK(only_words)) {
-			for (words = VAL_BLK_DATA(only_words); NOT_END(words); words++) {
-				if (IS_WORD(words) || IS_SET_WORD(words)) binds[VAL_WORD_CANON(words)] = 0;
-			}
-		}
-		else {
-			for (words = FRM_WORDS(source)+1; NOT_END(words); words++)
-				binds[VAL_BIND_CANON(words)] = 0;
-		}
-	}
 
 	CHECK_BIND_TABLE;
 
@@ -790,11 +997,19 @@
 }
 
 
+// The word hash of the frame (remade as words are added to it):
+#define GET_HASH() if (hashed) { \
+	hash = FRM_WORD_SERIES(frame)->series; \
+	slots = WORD_HASH_SLOTS(hash); \
+	mask = WORD_HASH_SIZE(hash) - 1; }
+
 /***********************************************************************
 **
-*/  static void Bind_Block_Words(REBSER *frame, REBVAL *value, REBCNT mode)
+*/  static void Bind_Block_Words(REBSER *frame, REBFLG hashed, REBVAL *value, REBCNT mode)
 /*
-**      Inner loop of bind block. Modes are:
+**      Inner loop of bind block. The words are looked up in the
+**      Bind_Table, or if hashed, in the word hash of the frame
+**      (kept by Append_Frame as words are added). Modes are:
 **
 **          BIND_ONLY    Only bind the words found in the frame.
 **          BIND_SET     Add set-words to the frame during the bind.
@@ -807,22 +1022,38 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
+	REBSER *hash = 0;
+	REBCNT *slots = 0;
+	REBCNT mask = 0;
+	REBCNT canon;
 	REBCNT n;
 	REBFLG selfish = !IS_SELFLESS(frame);
 
+	GET_HASH();
+
 	for (; NOT_END(value); value++) {
 		if (ANY_WORD(value)) {
 			//Print("Word: %s", Get_Sym_Name(VAL_WORD_CANON(value)));
+			canon = VAL_WORD_CANON(value);
+			if (hashed) {
+				for (n = (canon * WORD_HASH_MUL) & mask; slots[2*n+1] && slots[2*n] != canon; n = (n + 1) & mask);
+				n = slots[2*n+1];
+				// A hidden word is not bound, but a later one of its name is:
+				while (n && VAL_GET_OPT(FRM_WORD(frame, n), OPTS_HIDE)) {
+					for (n++; n < SERIES_TAIL(frame) && VAL_BIND_CANON(FRM_WORD(frame, n)) != canon; n++);
+					if (n == SERIES_TAIL(frame)) n = 0;
+				}
+			}
+			else n = Get_Bind(canon);
 			// Is the word found in this frame?
-			if (NZ(n = binds[VAL_WORD_CANON(value)])) {
+			if (n) {
 				if (n == NO_RESULT) n = 0; // SELF word
 				ASSERT1(n < SERIES_TAIL(frame), RP_BIND_BOUNDS);
 				// Word is in frame, bind it:
 				VAL_WORD_INDEX(value) = n;
 				VAL_WORD_FRAME(value) = frame;
 			}
-			else if (selfish && VAL_WORD_CANON(value) == SYM_SELF) {
+			else if (selfish && canon == SYM_SELF) {
 				VAL_WORD_INDEX(value) = 0;
 				VAL_WORD_FRAME(value) = frame;
 			}
@@ -830,14 +1061,23 @@
 				// Word is not in frame. Add it if option is specified:
 				if ((mode & BIND_ALL) || ((mode & BIND_SET) && (IS_SET_WORD(value)))) {
 					Append_Frame(frame, value, 0);
-					binds[VAL_WORD_CANON(value)] = VAL_WORD_INDEX(value);
+					if (!hashed) Set_Bind(canon, VAL_WORD_INDEX(value));
+					GET_HASH();
 				}
 			}
 		}
-		else if (ANY_BLOCK(value) && (mode & BIND_DEEP))
-			Bind_Block_Words(frame, VAL_BLK_DATA(value), mode);
-		else if ((IS_FUNCTION(value) || IS_CLOSURE(value)) && (mode & BIND_FUNC))
-			Bind_Block_Words(frame, BLK_HEAD(VAL_FUNC_BODY(value)), mode);
+		else if (ANY_BLOCK(value) && (mode & BIND_DEEP)) {
+			UNCOMPILE_BLOCK(VAL_SERIES(value));
+			REMEMBER_SERIES(VAL_SERIES(value));
+			Bind_Block_Words(frame, hashed, VAL_BLK_DATA(value), mode);
+			GET_HASH();
+		}
+		else if ((IS_FUNCTION(value) || IS_CLOSURE(value)) && (mode & BIND_FUNC)) {
+			UNCOMPILE_BLOCK(VAL_FUNC_BODY(value));
+			REMEMBER_SERIES(VAL_FUNC_BODY(value));
+			Bind_Block_Words(frame, hashed, BLK_HEAD(VAL_FUNC_BODY(value)), mode);
+			GET_HASH();
+		}
 	}
 }
 
@@ -854,33 +1094,36 @@
 **                      (note: word must not occur before the SET)
 **          BIND_DEEP - Recurse into sub-blocks.
 **
+**      A large frame (such as lib) is not put in the Bind_Table,
+**      its word hash is used (see Find_Word_Index).
+**
 ***********************************************************************/
 {
-	REBVAL *words;
+	REBSER *words = FRM_WORD_SERIES(frame);
 	REBCNT index;
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
 
 	CHECK_MEMORY(4);
 
 	CHECK_BIND_TABLE;
 
+	if (SERIES_TAIL(words) > WORD_HASH_MIN && (!words->series || IS_WORD_HASH(words->series))) {
+		Hash_Frame_Words(words);
+		Bind_Block_Words(frame, TRUE, block, mode);
+		return;
+	}
+
 	// Note about optimization: it's not a big win to avoid the
 	// binding table for short blocks (size < 4), because testing
 	// every block for the rare case adds up.
 
 	// Setup binding table:
-	index = 1;
+	Reset_Bind_Table();
 	for (index = 1; index < frame->tail; index++) {
-		words = FRM_WORD(frame, index);
-		if (!VAL_GET_OPT(words, OPTS_HIDE))
-			binds[VAL_BIND_CANON(words)] = index;
+		if (!VAL_GET_OPT(FRM_WORD(frame, index), OPTS_HIDE))
+			Set_Bind(VAL_BIND_CANON(FRM_WORD(frame, index)), index);
 	}
 
-	Bind_Block_Words(frame, block, mode);
-
-	// Reset binding table:
-	for (words = FRM_WORDS(frame)+1; NOT_END(words); words++)
-		binds[VAL_BIND_CANON(words)] = 0;
+	Bind_Block_Words(frame, FALSE, block, mode);
 
 	CHECK_BIND_TABLE;
 }
@@ -897,6 +1140,7 @@
 			UNBIND(val);
 		}
 		if (ANY_BLOCK(val) && deep) {
+			UNCOMPILE_BLOCK(VAL_SERIES(val));
 			Unbind_Block(VAL_BLK_DATA(val), TRUE);
 		}
 	}
@@ -940,7 +1184,7 @@
 	for (; NOT_END(value); value++) {
 		if (ANY_WORD(value)) {
 			// Is the word (canon sym) found in this frame?
-			if (NZ(n = WORDS_HEAD(Bind_Table)[VAL_WORD_CANON(value)])) {
+			if (NZ(n = Get_Bind(VAL_WORD_CANON(value)))) {
 				// Word is in frame, bind it:
 				VAL_WORD_INDEX(value) = n;
 				VAL_WORD_FRAME(value) = frame; // func body
@@ -949,6 +1193,9 @@
 		else if (ANY_BLOCK(value))
 			Bind_Relative_Words(frame, VAL_SERIES(value));
 	}
+
+	UNCOMPILE_BLOCK(block);
+	REMEMBER_SERIES(block);
 }
 
 
@@ -968,7 +1215,6 @@
 {
 	REBVAL *args;
 	REBINT index;
-	REBINT *binds = WORDS_HEAD(Bind_Table); // GC safe to do here
 
 	args = BLK_SKIP(words, 1);
 
@@ -977,15 +1223,12 @@
 	//Dump_Block(words);
 
 	// Setup binding table from the argument word list:
+	Reset_Bind_Table();
 	for (index = 1; NOT_END(args); args++, index++)
-		binds[VAL_BIND_CANON(args)] = -index;
+		Set_Bind(VAL_BIND_CANON(args), -index);
 
 	Bind_Relative_Words(frame, block);
 
-	// Reset binding table:
-	for (args = BLK_SKIP(words, 1); NOT_END(args); args++)
-		binds[VAL_BIND_CANON(args)] = 0;
-
 	CHECK_BIND_TABLE;
 }
 
@@ -1028,17 +1271,21 @@
 **
 ***********************************************************************/
 {
-	REBINT *binds = WORDS_HEAD(Bind_Table);
-
 	for (; NOT_END(data); data++) {
-		if (ANY_BLOCK(data))
+		if (ANY_BLOCK(data)) {
+			UNCOMPILE_BLOCK(VAL_SERIES(data));
+			REMEMBER_SERIES(VAL_SERIES(data));
 			Rebind_Block(src_frame, dst_frame, VAL_BLK_DATA(data), modes);
+		}
 		else if (ANY_WORD(data) && VAL_WORD_FRAME(data) == src_frame) {
 			VAL_WORD_FRAME(data) = dst_frame;
-			if (modes & REBIND_TABLE) VAL_WORD_INDEX(data) = binds[VAL_WORD_CANON(data)];
+			if (modes & REBIND_TABLE) VAL_WORD_INDEX(data) = Get_Bind(VAL_WORD_CANON(data));
 			if (modes & REBIND_TYPE) VAL_WORD_INDEX(data) = - VAL_WORD_INDEX(data);
-		} else if ((modes & REBIND_FUNC) && (IS_FUNCTION(data) || IS_CLOSURE(data)))
+		} else if ((modes & REBIND_FUNC) && (IS_FUNCTION(data) || IS_CLOSURE(data)) && !IS_METHOD(data)) {
+			UNCOMPILE_BLOCK(VAL_FUNC_BODY(data));
+			REMEMBER_SERIES(VAL_FUNC_BODY(data));
 			Rebind_Block(src_frame, dst_frame, BLK_HEAD(VAL_FUNC_BODY(data)), modes);
+		}
 	}
 }
 
@@ -1068,6 +1315,56 @@
 }
 
 
+/***********************************************************************
+**
+*/  REBSER *Hash_Frame_Words(REBSER *words)
+/*
+**      Bring the hash of a large frame word list up to date with
+**      the words added to it, or make it anew when it is missing or
+**      gets half full (see WORD HASH). Return it.
+**
+**      Of words with the same canon, the first is kept, as found
+**      by a search in order.
+**
+***********************************************************************/
+{
+	REBSER *hash = words->series;
+	REBCNT len = SERIES_TAIL(words);
+	REBCNT *slots;
+	REBCNT mask;
+	REBCNT canon;
+	REBCNT n;
+	REBCNT i;
+
+	if (!IS_WORD_HASH(hash) || WORD_HASH_COUNT(hash) > len || 2 * len > WORD_HASH_SIZE(hash)) {
+		for (n = 2 * WORD_HASH_MIN; n < 3 * len; n *= 2);
+		hash = Make_Series(n + 1, 2 * sizeof(REBCNT), FALSE);
+		CLEAR(hash->data, (n + 1) * 2 * sizeof(REBCNT));
+		hash->tail = n + 1;
+		SIDE_KIND(hash) = SIDE_WORDS;
+		WORD_HASH_SIZE(hash) = n;
+		WORD_HASH_COUNT(hash) = 1; // (not SELF)
+		words->series = hash;
+		REMEMBER_SERIES(words);
+	}
+
+	slots = WORD_HASH_SLOTS(hash);
+	mask = WORD_HASH_SIZE(hash) - 1;
+	for (n = WORD_HASH_COUNT(hash); n < len; n++) {
+		canon = VAL_BIND_CANON(BLK_SKIP(words, n));
+		for (i = (canon * WORD_HASH_MUL) & mask; slots[2*i+1]; i = (i + 1) & mask)
+			if (slots[2*i] == canon) break;
+		if (!slots[2*i+1]) {
+			slots[2*i] = canon;
+			slots[2*i+1] = n;
+		}
+	}
+	WORD_HASH_COUNT(hash) = len;
+
+	return hash;
+}
+
+
 /***********************************************************************
 **
 */  REBCNT Find_Word_Index(REBSER *frame, REBCNT sym, REBFLG always)
@@ -1076,15 +1373,37 @@
 **      Return the frame index for a word. Locate it by matching
 **      the canon word identifiers. Return 0 if not found.
 **
+**      A large frame is searched by the hash of its words, made
+**      when first needed. (The word list of a closure frame keeps
+**      the arg plan of the closure instead, and is searched.)
+**
 ***********************************************************************/
 {
-	REBCNT len = SERIES_TAIL(FRM_WORD_SERIES(frame));
+	REBSER *words = FRM_WORD_SERIES(frame);
+	REBCNT len = SERIES_TAIL(words);
 	REBVAL *word = FRM_WORDS(frame) + 1;
+	REBSER *hash;
+	REBCNT *slots;
+	REBCNT mask;
 	REBCNT n;
 	REBCNT s;
 
 	s = SYMBOL_TO_CANON(sym); // always compare to CANON sym
 
+	if (len > WORD_HASH_MIN && (!words->series || IS_WORD_HASH(words->series))) {
+		hash = (IS_WORD_HASH(words->series) && WORD_HASH_COUNT(words->series) == len)
+			? words->series : Hash_Frame_Words(words);
+		slots = WORD_HASH_SLOTS(hash);
+		mask = WORD_HASH_SIZE(hash) - 1;
+		for (n = (s * WORD_HASH_MUL) & mask; slots[2*n+1]; n = (n + 1) & mask) {
+			if (slots[2*n] == s) {
+				n = slots[2*n+1];
+				return (!always && VAL_GET_OPT(word + n - 1, OPTS_HIDE)) ? 0 : n;
+			}
+		}
+		return 0;
+	}
+
 	for (n = 1; n < len; n++, word++)
 		if (sym == VAL_BIND_SYM(word) || s == VAL_BIND_CANON(word))
 			return (!always && VAL_GET_OPT(word, OPTS_HIDE)) ? 0 : n;
@@ -1093,6 +1412,64 @@
 }
 
 
+/***********************************************************************
+**
+*/  REBCNT Find_Path_Index(REBPVS *pvs, REBSER *frame)
+/*
+**      Find_Word_Index for the word selected by a path from an
+**      object frame. The path keeps the word lists it has seen at
+**      that point and the index found in each (see REBPIC), so when
+**      the frame has one of them, the word is just checked.
+**
+***********************************************************************/
+{
+	REBSER *path;
+	REBSER *words = FRM_WORD_SERIES(frame);
+	REBCNT sym = VAL_WORD_SYM(pvs->select);
+	REBVAL *word;
+	REBPIC *pic;
+	REBCNT n;
+	REBCNT i;
+
+	if (!pvs->path) return Find_Word_Index(frame, sym, FALSE); // (Pick_Path)
+
+	path = VAL_SERIES(pvs->orig);
+	n = pvs->path - BLK_HEAD(path);
+
+	if (!path->series) {
+		path->series = Make_Series((SERIES_TAIL(path) + 1) * PIC_UNITS, sizeof(REBUPT), FALSE);
+		CLEAR_SERIES(path->series);
+		path->series->tail = SERIES_TAIL(path) * PIC_UNITS;
+		SIDE_KIND(path->series) = SIDE_PATH;
+		REMEMBER_SERIES(path);
+	}
+	else if (!IS_PATH_CACHE(path->series))
+		return Find_Word_Index(frame, sym, FALSE);
+
+	if (n >= PATH_CACHE_LEN(path->series)) return Find_Word_Index(frame, sym, FALSE);
+	pic = PATH_CACHE_SKIP(path->series, n);
+
+	for (i = 0; i < PATH_WAYS; i++) {
+		if (pic->words[i] == words && pic->index[i] < SERIES_TAIL(words)) {
+			word = BLK_SKIP(words, pic->index[i]);
+			if ((sym == VAL_BIND_SYM(word) || SYMBOL_TO_CANON(sym) == VAL_BIND_CANON(word))
+				&& !VAL_GET_OPT(word, OPTS_HIDE)) return pic->index[i];
+		}
+	}
+
+	n = Find_Word_Index(frame, sym, FALSE);
+	if (n) {
+		for (i = PATH_WAYS - 1; i > 0; i--) {
+			pic->words[i] = pic->words[i-1];
+			pic->index[i] = pic->index[i-1];
+		}
+		pic->words[0] = words;
+		pic->index[0] = n;
+	}
+	return n;
+}
+
+
 /***********************************************************************
 **
 */  REBVAL *Find_Word_Value(REBSER *frame, REBCNT sym)
@@ -1179,15 +1556,24 @@
 	if (index >= 0) return FRM_VALUES(frame)+index;
 
 	// A negative index indicates that the value is in a frame on
-	// the data stack, so now we must find it by walking back the
-	// stack looking for the function that the word is bound to.
-	dsf = DSF;
-	while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
-		dsf = PRIOR_DSF(dsf);
-		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+	// the data stack. The function keeps the frame of its running
+	// body (see Do_Function), else we must find it by walking back
+	// the stack looking for the function that the word is bound to.
+	dsf = (REBINT)FUNC_ACTIVE(frame);
+	if (!IS_ACTIVE_DSF(dsf, frame)) {
+		dsf = DSF;
+		while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
+			dsf = PRIOR_DSF(dsf);
+			if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+		}
 	}
 //	if (Trace_Level) Dump_Stack_Frame(dsf);
-	return DSF_ARGS(dsf, -index);
+
+	// A field of the object of a method (see Make_Method). No closure
+	// has relative words past its args:
+	index = -index - (REBINT)SERIES_TAIL(frame);
+	if (index >= 0) return FRM_VALUES(VAL_METHOD_SELF(DSF_FUNC(dsf))) + index;
+	return DSF_VAR(dsf, -VAL_WORD_INDEX(word));
 }
 
 
@@ -1212,15 +1598,24 @@
 	}
 
 	// A negative index indicates that the value is in a frame on
-	// the data stack, so now we must find it by walking back the
-	// stack looking for the function that the word is bound to.
-	dsf = DSF;
-	while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
-		dsf = PRIOR_DSF(dsf);
-		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+	// the data stack. The function keeps the frame of its running
+	// body (see Do_Function), else we must find it by walking back
+	// the stack looking for the function that the word is bound to.
+	dsf = (REBINT)FUNC_ACTIVE(frame);
+	if (!IS_ACTIVE_DSF(dsf, frame)) {
+		dsf = DSF;
+		while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
+			dsf = PRIOR_DSF(dsf);
+			if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+		}
 	}
 //	if (Trace_Level) Dump_Stack_Frame(dsf);
-	return DSF_ARGS(dsf, -index);
+
+	// A field of the object of a method (see Make_Method):
+	index = -index - (REBINT)VAL_FUNC_ARGC(DSF_FUNC(dsf));
+	if (index >= 0 && VAL_PROTECTED(FRM_WORDS(VAL_METHOD_SELF(DSF_FUNC(dsf))) + index))
+		Trap1(RE_LOCKED_WORD, word);
+	return DSF_VAR(dsf, -VAL_WORD_INDEX(word));
 }
 
 
@@ -1238,12 +1633,15 @@
 
 	if (!frame) return 0;
 	if (index >= 0) return FRM_VALUES(frame)+index;
-	dsf = DSF;
-	while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
-		dsf = PRIOR_DSF(dsf);
-		if (dsf <= 0) return 0;
+	dsf = (REBINT)FUNC_ACTIVE(frame);
+	if (!IS_ACTIVE_DSF(dsf, frame)) {
+		dsf = DSF;
+		while (frame != VAL_WORD_FRAME(DSF_WORD(dsf))) {
+			dsf = PRIOR_DSF(dsf);
+			if (dsf <= 0) return 0;
+		}
 	}
-	return DSF_ARGS(dsf, -index);
+	return DSF_VAR(dsf, -index);
 }
 
 
@@ -1282,6 +1680,8 @@
 
 	if (!HAS_FRAME(word)) Trap1(RE_NOT_DEFINED, word);
 
+	NOTE_OP_SET(value);
+
 //	ASSERT(index, RP_BAD_SET_INDEX);
 	ASSERT(VAL_WORD_FRAME(word), RP_BAD_SET_CONTEXT);
 //  Print("Set %s to %s [frame: %x idx: %d]", Get_Word_Name(word), Get_Type_Name(value), VAL_WORD_FRAME(word), VAL_WORD_INDEX(word));
@@ -1296,12 +1696,68 @@
 	if (index == 0) Trap0(RE_SELF_PROTECTED);
 
 	// Find relative value:
-	dsf = DSF;
-	while (VAL_WORD_FRAME(word) != VAL_WORD_FRAME(DSF_WORD(dsf))) {
-		dsf = PRIOR_DSF(dsf);
-		if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+	frm = VAL_WORD_FRAME(word);
+	dsf = (REBINT)FUNC_ACTIVE(frm);
+	if (!IS_ACTIVE_DSF(dsf, frm)) {
+		dsf = DSF;
+		while (frm != VAL_WORD_FRAME(DSF_WORD(dsf))) {
+			dsf = PRIOR_DSF(dsf);
+			if (dsf <= 0) Trap1(RE_NOT_DEFINED, word); // change error !!!
+		}
+	}
+
+	// A field of the object of a method (see Make_Method):
+	index = -index - (REBINT)VAL_FUNC_ARGC(DSF_FUNC(dsf));
+	if (index >= 0) {
+		if (index == 0) Trap0(RE_SELF_PROTECTED);
+		frm = VAL_METHOD_SELF(DSF_FUNC(dsf));
+		if (VAL_PROTECTED(FRM_WORDS(frm)+index))
+			Trap1(RE_LOCKED_WORD, word);
+		FRM_VALUES(frm)[index] = *value;
+		return;
+	}
+	*DSF_VAR(dsf, -VAL_WORD_INDEX(word)) = *value;
+}
+
+
+/***********************************************************************
+**
+*/  REBSER *Word_Frame(REBVAL *word)
+/*
+**      Return the frame of a word. The words of a method body that
+**      refer to its object are relative to the method, so their
+**      frame is the object of the running call (see Make_Method).
+**
+***********************************************************************/
+{
+	REBSER *frame = VAL_WORD_FRAME(word);
+	REBINT dsf;
+
+	if (VAL_WORD_INDEX(word) >= 0) return frame;
+	dsf = (REBINT)FUNC_ACTIVE(frame);
+	if (IS_ACTIVE_DSF(dsf, frame) && IS_METHOD(DSF_FUNC(dsf))
+		&& -VAL_WORD_INDEX(word) >= (REBINT)VAL_FUNC_ARGC(DSF_FUNC(dsf)))
+		return VAL_METHOD_SELF(DSF_FUNC(dsf));
+	return frame;
+}
+
+
+/***********************************************************************
+**
+*/	void Drop_Active_Frames(REBINT dsf)
+/*
+**		A throw (longjmp) back to the given stack frame has left the
+**		bodies of functions above it. Give those functions back the
+**		frames that were active before them (see FUNC_ACTIVE).
+**
+***********************************************************************/
+{
+	REBINT d;
+
+	for (d = DSF; d > dsf; d = PRIOR_DSF(d)) {
+		if (DSF_ACTIVE(d) >= 0 && (IS_FUNCTION(DSF_FUNC(d)) || IS_CLOSURE(DSF_FUNC(d))))
+			FUNC_ACTIVE(VAL_FUNC_ARGS(DSF_FUNC(d))) = DSF_ACTIVE(d);
 	}
-	*DSF_ARGS(dsf, -index) = *value;
 }
 
 
@@ -1412,4 +1868,9 @@
 {
 	// Temporary block used while scanning for frame words:
 	Set_Root_Series(TASK_BUF_WORDS, Make_Block(100), "word cache"); // just holds words, no GC
+
+	// The bind table. Used to cache context indexes for given symbols.
+	Bind_Table = Make_Bind_Table(BIND_TABLE_SIZE);
+	Bind_Mark = 1;
+	Bind_Count = 0;
 }
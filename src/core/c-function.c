@@ -128,6 +128,7 @@
 
 	blk = BLK_HEAD(block);
 	words = Collect_Frame(BIND_ALL | BIND_NO_DUP | BIND_NO_SELF, 0, blk);
+	FUNC_ACTIVE(words) = -1; // not run yet (see Make_Method)
 
 	// !!! needs more checks
 	for (; NOT_END(blk); blk++) {
@@ -160,17 +161,431 @@
 }
 
 
+/***********************************************************************
+**
+*/	REBSER *Make_Arg_Plan(REBSER *words)
+/*
+**		Decode the word list of a function into the plan Do_Args
+**		follows: the kind of each arg, whether it needs a datatype
+**		check, and a table of refinements to find them by symbol.
+**		Kept in the header of the word list; made again if the
+**		list changes length (a closure frame can gain words).
+**
+***********************************************************************/
+{
+	REBCNT len = SERIES_TAIL(words);
+	REBSER *plan;
+	REBCNT *kinds;
+	REBCNT *refs;
+	REBVAL *args;
+	REBCNT n;
+	REBCNT kind;
+
+	plan = Make_Series(PLAN_HEAD + 3 * len, sizeof(REBCNT), FALSE);
+	SIDE_KIND(plan) = SIDE_PLAN;
+	PLAN_VALUE(plan, PLAN_LEN) = len;
+	PLAN_VALUE(plan, PLAN_REFS) = 0;
+	kinds = PLAN_KINDS(plan);
+	refs = PLAN_REFINES(plan);
+
+	for (n = 1, args = BLK_SKIP(words, 1); n < len; n++, args++) {
+		switch (VAL_TYPE(args)) {
+		case REB_WORD:		kind = ARG_EVAL; break;
+		case REB_LIT_WORD:	kind = ARG_QUOTE; break;
+		case REB_GET_WORD:	kind = ARG_GET; break;
+		case REB_REFINEMENT:
+			kind = ARG_REFINE;
+			*refs++ = VAL_WORD_CANON(args);
+			*refs++ = n;
+			PLAN_VALUE(plan, PLAN_REFS)++;
+			break;
+		default:
+			kind = 0; // Trap_Arg() when reached
+		}
+		// Any value but unset is allowed by an untyped word:
+		if ((VAL_BIND_TYPESET(args) | TYPESET(REB_END) | TYPESET(REB_UNSET)) != ALL_64)
+			kind |= ARG_TYPED;
+		kinds[n] = kind;
+	}
+
+	// Plain word args, if followed only by refinements (see Plan_Call):
+	for (n = 1; n < len && (kinds[n] & ARG_KIND) == ARG_EVAL; n++);
+	PLAN_VALUE(plan, PLAN_ARGC) = (n == len || (kinds[n] & ARG_KIND) == ARG_REFINE) ? n - 1 : NO_PLAN;
+
+	plan->tail = refs - (REBCNT *)(plan->data);
+	words->series = plan;
+	REMEMBER_SERIES(words);
+
+	return plan;
+}
+
+
+// Natives that evaluate these block args in place, and do not keep
+// them (so a shared closure or method body block need not be copied
+// for them). REDUCE copies what it keeps of them (see UNSHARE):
+REBNATIVE(either);
+REBNATIVE(if);
+REBNATIVE(unless);
+REBNATIVE(while);
+REBNATIVE(until);
+REBNATIVE(loop);
+REBNATIVE(forever);
+REBNATIVE(case);
+REBNATIVE(switch);
+REBNATIVE(all);
+REBNATIVE(any);
+REBNATIVE(catch);
+REBNATIVE(try);
+REBNATIVE(attempt);
+REBNATIVE(foreach);
+REBNATIVE(repeat);
+REBNATIVE(for);
+REBNATIVE(forall);
+REBNATIVE(forskip);
+REBNATIVE(print);
+REBNATIVE(prin);
+REBNATIVE(reduce);
+
+static const struct {
+	REBFUN func;
+	REBCNT args;	// bit per arg number
+} Shared_Args[] = {
+	{N_either,	(1<<2) | (1<<3)},
+	{N_if,		(1<<2)},
+	{N_unless,	(1<<2)},
+	{N_while,	(1<<1) | (1<<2)},
+	{N_until,	(1<<1)},
+	{N_loop,	(1<<2)},
+	{N_forever,	(1<<1)},
+	{N_case,	(1<<1)},
+	{N_switch,	(1<<2) | (1<<4)},
+	{N_all,		(1<<1)},
+	{N_any,		(1<<1)},
+	{N_catch,	(1<<1)},
+	{N_try,		(1<<1) | (1<<3)},
+	{N_attempt,	(1<<1)},
+	{N_foreach,	(1<<3)},
+	{N_repeat,	(1<<3)},
+	{N_for,		(1<<5)},
+	{N_forall,	(1<<2)},
+	{N_forskip,	(1<<3)},
+	{N_print,	(1<<1)},
+	{N_prin,	(1<<1)},
+	{N_reduce,	(1<<1)},
+	{0, 0}
+};
+
+
 /***********************************************************************
 **
 */	void Make_Native(REBVAL *value, REBSER *spec, REBFUN func, REBINT type)
 /*
 ***********************************************************************/
 {
+	REBCNT n;
+	REBCNT i;
+
 	//Print("Make_Native: %s spec %d", Get_Sym_Name(type+1), SERIES_TAIL(spec));
 	VAL_FUNC_SPEC(value) = spec;
 	VAL_FUNC_ARGS(value) = Check_Func_Spec(spec);
 	VAL_FUNC_CODE(value) = func;
 	VAL_SET(value, type);
+
+	for (n = 0; Shared_Args[n].func; n++) {
+		if (Shared_Args[n].func != func) continue;
+		for (i = 1; i < SERIES_TAIL(VAL_FUNC_ARGS(value)); i++)
+			if (Shared_Args[n].args & (1 << i))
+				VAL_SET_OPT(BLK_SKIP(VAL_FUNC_ARGS(value), i), OPTS_SHARE);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Share_Block(REBVAL *data)
+/*
+**		Flag the series values of a closure body, deeply, as shared
+**		by all calls of the closure (see Do_Closure).
+**
+***********************************************************************/
+{
+	for (; NOT_END(data); data++) {
+		if (TYPESET(VAL_TYPE(data)) & TS_STD_SERIES) {
+			VAL_SET_OPT(data, OPTS_SHARE);
+			if (ANY_BLOCK(data)) Share_Block(VAL_BLK(data));
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Bind_Active_Word(REBVAL *word, REBINT dsf)
+/*
+**		Bind a relative word of a running closure to its frame, or
+**		one of a running method to its object (see DSF_VAR). Words
+**		of the args of a method stay relative, as for any function.
+**
+***********************************************************************/
+{
+	REBVAL *func = DSF_FUNC(dsf);
+	REBINT n = -VAL_WORD_INDEX(word);
+
+	if (IS_CLOSURE(func)) {
+		VAL_WORD_FRAME(word) = VAL_SERIES(DSF_RETURN(dsf));
+		VAL_WORD_INDEX(word) = n;
+	}
+	else if (n >= (REBINT)VAL_FUNC_ARGC(func)) {
+		VAL_WORD_FRAME(word) = VAL_METHOD_SELF(func);
+		VAL_WORD_INDEX(word) = n - VAL_FUNC_ARGC(func);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static void Unshare_Block(REBINT dsf, REBVAL *data)
+/*
+**		Bind the relative words of a copied closure or method body
+**		block for the running call, and clear its shared flags.
+**
+***********************************************************************/
+{
+	REBSER *args = VAL_FUNC_ARGS(DSF_FUNC(dsf));
+
+	for (; NOT_END(data); data++) {
+		VAL_CLR_OPT(data, OPTS_SHARE);
+		if (ANY_BLOCK(data))
+			Unshare_Block(dsf, VAL_BLK(data));
+		else if (ANY_WORD(data) && VAL_WORD_FRAME(data) == args && VAL_WORD_INDEX(data) < 0)
+			Bind_Active_Word(data, dsf);
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Find_Copied_Series(REBVAL *data, REBVAL *copy, REBSER *series)
+/*
+**		Find a series of a block in a deep copy of it (see Copy_Method).
+**		Returns zero if it is not there, or if a block of the copy has
+**		been changed so the values no longer match.
+**
+***********************************************************************/
+{
+	REBSER *ser;
+
+	for (; NOT_END(data); data++, copy++) {
+		if (IS_END(copy) || VAL_TYPE(copy) != VAL_TYPE(data)) return 0;
+		if (!(TYPESET(VAL_TYPE(data)) & TS_STD_SERIES)) continue;
+		if (VAL_SERIES(data) == series) return VAL_SERIES(copy);
+		if (ANY_BLOCK(data) && NZ(ser = Find_Copied_Series(BLK_HEAD(VAL_SERIES(data)), BLK_HEAD(VAL_SERIES(copy)), series)))
+			return ser;
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Own_Method_Series(REBINT dsf, REBSER *series)
+/*
+**		A series of the shared body of a running method is escaping.
+**		An object had a copy of the body of its own before methods
+**		were shared, so a literal series kept what was done to it from
+**		call to call. To keep that, the object now gets its copy (made
+**		once, see Copy_Method), and the series of it is returned.
+**
+**		Returns zero if the object no longer holds the method.
+**
+***********************************************************************/
+{
+	REBVAL *func = DSF_FUNC(dsf);
+	REBSER *args = VAL_FUNC_ARGS(func);
+	REBVAL *val = FRM_VALUES(VAL_METHOD_SELF(func)) + 1;
+
+	// Find the method, or the copy made of it (that has its args):
+	for (; NOT_END(val); val++) {
+		if (!IS_FUNCTION(val) || VAL_FUNC_ARGS(val) != args) continue;
+		if (IS_METHOD(val)) {
+			if (VAL_METHOD_SELF(val) != VAL_METHOD_SELF(func)) continue;
+			Copy_Method(val, TRUE);
+		}
+		return Find_Copied_Series(BLK_HEAD(VAL_FUNC_BODY(func)), BLK_HEAD(VAL_FUNC_BODY(val)), series);
+	}
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	void Unshare_Value(REBVAL *value)
+/*
+**		A value of a shared closure or method body is escaping from
+**		the running call: it may be kept after the call, or be
+**		modified. Give it a deep copy of its series, with the relative
+**		words bound for the call (see Bind_Active_Word), as the body
+**		of the call would have if it had been copied.
+**
+**		A relative word of a running closure or method is bound too.
+**
+**		Outside of closure and method calls, values are left as they are.
+**
+***********************************************************************/
+{
+	REBSER *args;
+	REBSER *ser;
+	REBINT dsf;
+
+	if (ANY_WORD(value)) {
+		args = VAL_WORD_FRAME(value);
+		if (!args || VAL_WORD_INDEX(value) >= 0) return;
+		dsf = (REBINT)FUNC_ACTIVE(args);
+		if (IS_ACTIVE_DSF(dsf, args)) Bind_Active_Word(value, dsf);
+		return;
+	}
+
+	// Find the running closure or method the value comes from:
+	for (dsf = DSF; dsf > 0; dsf = PRIOR_DSF(dsf))
+		if ((IS_CLOSURE(DSF_FUNC(dsf)) || IS_METHOD(DSF_FUNC(dsf))) && DSF_ACTIVE(dsf) >= 0) break;
+	if (dsf <= 0 || !(TYPESET(VAL_TYPE(value)) & TS_STD_SERIES)) return;
+
+	VAL_CLR_OPT(value, OPTS_SHARE);
+	if (IS_METHOD(DSF_FUNC(dsf)) && NZ(ser = Own_Method_Series(dsf, VAL_SERIES(value)))) {
+		VAL_SERIES(value) = ser;
+		return;
+	}
+	VAL_SERIES(value) = Copy_Series(VAL_SERIES(value));
+	if (ANY_BLOCK(value)) {
+		Copy_Deep_Values(VAL_SERIES(value), 0, VAL_TAIL(value), TS_CODE);
+		Unshare_Block(dsf, BLK_HEAD(VAL_SERIES(value)));
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Count_Frame_Words(REBVAL *data, REBSER *frame)
+/*
+**		Count the words of a function body bound to a frame.
+**		Returns -1 if the body holds a function value.
+**
+***********************************************************************/
+{
+	REBINT count = 0;
+	REBINT n;
+
+	for (; NOT_END(data); data++) {
+		if (ANY_BLOCK(data)) {
+			if ((n = Count_Frame_Words(VAL_BLK(data), frame)) < 0) return -1;
+			count += n;
+		}
+		else if (ANY_WORD(data) && VAL_WORD_FRAME(data) == frame && VAL_WORD_INDEX(data) >= 0)
+			count++;
+		else if (ANY_FUNC(data)) return -1;
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Rebind_Method(REBVAL *data, REBSER *args, REBSER *words, REBSER *frame, REBFLG share)
+/*
+**		Bind the words of a copied method body to its new args words.
+**		If share, words bound to the object frame become relative to
+**		the args (past their tail, see DSF_VAR) and the series values
+**		are flagged as shared. Else the reverse, for a copy of the
+**		body of its own.
+**
+***********************************************************************/
+{
+	REBINT tail = SERIES_TAIL(args);
+
+	for (; NOT_END(data); data++) {
+		if (share && (TYPESET(VAL_TYPE(data)) & TS_STD_SERIES)) VAL_SET_OPT(data, OPTS_SHARE);
+		else VAL_CLR_OPT(data, OPTS_SHARE);
+		if (ANY_BLOCK(data))
+			Rebind_Method(VAL_BLK(data), args, words, frame, share);
+		else if (!ANY_WORD(data)) continue;
+		else if (share && VAL_WORD_FRAME(data) == frame && VAL_WORD_INDEX(data) >= 0) {
+			VAL_WORD_FRAME(data) = words;
+			VAL_WORD_INDEX(data) = -(tail + VAL_WORD_INDEX(data));
+		}
+		else if (VAL_WORD_FRAME(data) == args) {
+			if (!share && -VAL_WORD_INDEX(data) >= tail) {
+				VAL_WORD_FRAME(data) = frame;
+				VAL_WORD_INDEX(data) = -VAL_WORD_INDEX(data) - tail;
+			}
+			else VAL_WORD_FRAME(data) = words;
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Make_Method(REBVAL *value, REBSER *frame)
+/*
+**		Make a function of an object frame a method, to be shared by
+**		the objects made from it. Its body is copied once, with the
+**		words bound to the frame made relative to its args: they refer
+**		to the object of the running call, which a method holds in
+**		place of its spec (see DSF_VAR). Series values of the body are
+**		shared by all calls, as for a closure (see Unshare_Value).
+**
+**		Returns FALSE for a function that does not refer to the frame,
+**		that holds functions in its body, or that has run, as a literal
+**		series of its body may be held from the call (it is copied as
+**		before).
+**
+***********************************************************************/
+{
+	REBSER *args = VAL_FUNC_ARGS(value);
+	REBSER *body = VAL_FUNC_BODY(value);
+	REBSER *words;
+
+	if (FUNC_ACTIVE(args) >= 0 || Count_Frame_Words(BLK_HEAD(body), frame) <= 0) return FALSE;
+
+	words = Copy_Block(args, 0);
+	FUNC_ACTIVE(words) = 0;
+	ARGS_SPEC(words) = VAL_FUNC_SPEC(value);
+	body = Copy_Block_Values(body, 0, SERIES_TAIL(body), TS_CODE);
+	Rebind_Method(BLK_HEAD(body), args, words, frame, TRUE);
+
+	VAL_FUNC_SPEC(value) = frame;
+	VAL_FUNC_ARGS(value) = words;
+	VAL_FUNC_BODY(value) = body;
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	void Copy_Method(REBVAL *value, REBFLG same_args)
+/*
+**		Make a method a function of its own, with a copy of its body
+**		bound to its object (as it was before being shared).
+**
+**		If same_args, it keeps the args of the method, so the words
+**		of its body are relative to them as before (see Own_Method_Series).
+**
+***********************************************************************/
+{
+	REBSER *args = VAL_FUNC_ARGS(value);
+	REBSER *body = VAL_FUNC_BODY(value);
+	REBSER *frame = VAL_METHOD_SELF(value);
+
+	VAL_FUNC_SPEC(value) = ARGS_SPEC(args);
+	if (!same_args) {
+		VAL_FUNC_ARGS(value) = Copy_Block(args, 0);
+		FUNC_ACTIVE(VAL_FUNC_ARGS(value)) = -1;
+	}
+	VAL_FUNC_BODY(value) = body = Copy_Block_Values(body, 0, SERIES_TAIL(body), TS_CODE);
+	Rebind_Method(BLK_HEAD(body), args, VAL_FUNC_ARGS(value), frame, FALSE);
 }
 
 
@@ -207,6 +622,10 @@
 	if (type == REB_FUNCTION || type == REB_CLOSURE)
 		Bind_Relative(VAL_FUNC_ARGS(value), VAL_FUNC_ARGS(value), VAL_FUNC_BODY(value));
 
+	if (type == REB_CLOSURE) Share_Block(BLK_HEAD(VAL_FUNC_BODY(value)));
+
+	if (type == REB_REBCODE) return Make_Rebcode(value);
+
 	return TRUE;
 }
 
@@ -220,10 +639,14 @@
 	REBVAL *spec;
 	REBVAL *body;
 
+	if (IS_METHOD(value)) Copy_Method(value, FALSE);
+
 	if (!args || ((spec = VAL_BLK(args)) && IS_END(spec))) {
 		body = 0;
-		if (IS_FUNCTION(value) || IS_CLOSURE(value))
+		if (IS_FUNCTION(value) || IS_CLOSURE(value)) {
 			VAL_FUNC_ARGS(value) = Copy_Block(VAL_FUNC_ARGS(value), 0);
+			FUNC_ACTIVE(VAL_FUNC_ARGS(value)) = -1;
+		}
 	} else {
 		body = VAL_BLK_SKIP(args, 1);
 		// Spec given, must be block or *
@@ -233,23 +656,32 @@
 		} else {
 			if (!IS_STAR(spec)) return FALSE;
 			VAL_FUNC_ARGS(value) = Copy_Block(VAL_FUNC_ARGS(value), 0);
+			FUNC_ACTIVE(VAL_FUNC_ARGS(value)) = -1;
 		}
 	}
 
 	if (body && !IS_END(body)) {
-		if (!IS_FUNCTION(value) && !IS_CLOSURE(value)) return FALSE;
+		if (!IS_FUNCTION(value) && !IS_CLOSURE(value) && !IS_REBCODE(value)) return FALSE;
 		// Body must be block:
 		if (!IS_BLOCK(body)) return FALSE;
 		VAL_FUNC_BODY(value) = VAL_SERIES(body);
+		if (IS_REBCODE(value)) return Make_Rebcode(value);
 	}
 	// No body, use prototype:
 	else if (IS_FUNCTION(value) || IS_CLOSURE(value))
 		VAL_FUNC_BODY(value) = Clone_Block(VAL_FUNC_BODY(value));
+	// New spec, so registers must be assembled again:
+	else if (IS_REBCODE(value) && body) {
+		VAL_FUNC_BODY(value) = Rebcode_Source(value);
+		return Make_Rebcode(value);
+	}
 
 	// Rebind function words:
 	if (IS_FUNCTION(value) || IS_CLOSURE(value))
 		Bind_Relative(VAL_FUNC_ARGS(value), VAL_FUNC_ARGS(value), VAL_FUNC_BODY(value));
 
+	if (IS_CLOSURE(value)) Share_Block(BLK_HEAD(VAL_FUNC_BODY(value)));
+
 	return TRUE;
 }
 
@@ -262,9 +694,16 @@
 {
 	REBSER *src_frame = VAL_FUNC_ARGS(func);
 
+	if (IS_METHOD(func)) {
+		*value = *func;
+		Copy_Method(value, FALSE);
+		return;
+	}
+
 	VAL_FUNC_SPEC(value) = VAL_FUNC_SPEC(func);
 	VAL_FUNC_BODY(value) = Clone_Block(VAL_FUNC_BODY(func));
 	VAL_FUNC_ARGS(value) = Copy_Block(src_frame, 0);
+	FUNC_ACTIVE(VAL_FUNC_ARGS(value)) = -1;
 	// VAL_FUNC_BODY(value) = Clone_Block(VAL_FUNC_BODY(func));
 	VAL_FUNC_BODY(value) = Copy_Block_Values(VAL_FUNC_BODY(func), 0, SERIES_TAIL(VAL_FUNC_BODY(func)), TS_CLONE);
 	Rebind_Block(src_frame, VAL_FUNC_ARGS(value), BLK_HEAD(VAL_FUNC_BODY(value)), 0);
@@ -399,66 +838,107 @@
 
 /***********************************************************************
 **
-*/	void Do_Function(REBVAL *func)
+*/	static REBVAL *Do_Function_Body(REBVAL *func)
 /*
 ***********************************************************************/
 {
 	REBVAL *result;
-	REBVAL *ds;
+	REBSER *body = VAL_FUNC_BODY(func);
+	REBSER *args = VAL_FUNC_ARGS(func);
+	REBINT dsf = DSF;
 #ifdef DEBUGGING
 	REBYTE *name = Get_Word_Name(DSF_WORD(DSF));
 #endif
 
-	Eval_Functions++;
+	if (!BLK_CODE(body)) Compile_Block(body, CODE_DEPTH);
+
+	// Relative words of the body now refer to this frame:
+	DSF_ACTIVE(dsf) = MAX((REBINT)FUNC_ACTIVE(args), 0);
+	FUNC_ACTIVE(args) = dsf;
 
 	//Dump_Block(VAL_FUNC_BODY(func));
-	result = Do_Blk(VAL_FUNC_BODY(func), 0);
-	ds = DS_RETURN;
+	result = Do_Tail_Blk(body, 0);
+	if (VAL_GET_OPT(result, OPTS_SHARE)) Unshare_Value(result);
 
-	if (IS_ERROR(result) && IS_RETURN(result)) {
-		// Value below is kept safe from GC because no-allocation is
-		// done between point of SET_THROW and here.
-		if (VAL_ERR_VALUE(result))
-			*ds = *VAL_ERR_VALUE(result);
-		else
-			SET_UNSET(ds);
-	}
-	else *ds = *result; // Set return value (atomic)
+	FUNC_ACTIVE(args) = DSF_ACTIVE(dsf);
+	DSF_ACTIVE(dsf) = -1;
+
+	return result;
 }
 
 
 /***********************************************************************
 **
-*/	void Do_Closure(REBVAL *func)
+*/	static REBVAL *Do_Closure_Body(REBVAL *func)
 /*
-**		Do a closure by cloning its body and rebinding it to
-**		a new frame of words/values.
+**		Do a closure with a new frame of words/values.
+**
+**		Its body is shared by all calls. The relative words of
+**		the body refer to the frame of the running call (see DSF_VAR),
+**		and values of the body are copied and bound to the frame only
+**		when they escape from it (see Unshare_Value).
 **
 ***********************************************************************/
 {
-	REBSER *body;
-	REBSER *frame;
 	REBVAL *result;
-	REBVAL *ds;
-
-	Eval_Functions++;
-	//DISABLE_GC;
+	REBSER *body = VAL_FUNC_BODY(func);
+	REBSER *args = VAL_FUNC_ARGS(func);
+	REBSER *frame;
+	REBINT dsf = DSF;
 
-	// Clone the body of the function to allow rebinding to it:
-	body = Clone_Block(VAL_FUNC_BODY(func));
+	if (!BLK_CODE(body)) Compile_Block(body, CODE_DEPTH);
 
 	// Copy stack frame args as the closure object (one extra at head)
-	frame = Copy_Values(BLK_SKIP(DS_Series, DS_ARG_BASE), SERIES_TAIL(VAL_FUNC_ARGS(func)));
-	SET_FRAME(BLK_HEAD(frame), 0, VAL_FUNC_ARGS(func));
+	frame = Copy_Values(BLK_SKIP(DS_Series, DS_ARG_BASE), SERIES_TAIL(args));
+	SET_FRAME(BLK_HEAD(frame), 0, args);
+	SET_OBJECT(DS_RETURN, frame); // keep it GC safe
 
-	// Rebind the body to the new context (deeply):
-	Rebind_Block(VAL_FUNC_ARGS(func), frame, BLK_HEAD(body), REBIND_TYPE);
+	DSF_ACTIVE(dsf) = MAX((REBINT)FUNC_ACTIVE(args), 0);
+	FUNC_ACTIVE(args) = dsf;
 
-	ds = DS_RETURN;
-	SET_OBJECT(ds, body); // keep it GC safe
-	result = Do_Blk(body, 0); // GC-OK - also, result returned on DS stack
-	ds = DS_RETURN;
+	result = Do_Tail_Blk(body, 0); // GC-OK - also, result returned on DS stack
+	if (VAL_GET_OPT(result, OPTS_SHARE)) Unshare_Value(result);
+
+	FUNC_ACTIVE(args) = DSF_ACTIVE(dsf);
+	DSF_ACTIVE(dsf) = -1;
+
+	return result;
+}
+
+
+/***********************************************************************
+**
+*/	static void Do_Body(REBVAL *func)
+/*
+**		Evaluate the body of a FUNCTION! or CLOSURE! and set the
+**		return value of its frame.
+**
+**		A tail call made by the body is done here, not below it: the
+**		frame of the callee (left above the stack, see Do_Tail_Blk)
+**		replaces the current one and its body is evaluated in turn.
+**		So tail recursion runs in constant C and DS stack space.
+**
+***********************************************************************/
+{
+	REBVAL *result;
+	REBVAL *ds;
+	REBINT dsf;
+	REBCNT argc;
+
+	while (TRUE) {
+		Eval_Functions++;
+		result = IS_CLOSURE(func) ? Do_Closure_Body(func) : Do_Function_Body(func);
+		if (!IS_ERROR(result) || VAL_ERR_NUM(result) != RE_TAIL_CALL) break;
+
+		// Move the word, func, and args of the callee down to this frame:
+		dsf = VAL_ERR_VALUE(result) - DS_Base;
+		argc = SERIES_TAIL(VAL_FUNC_WORDS(DSF_FUNC(dsf))) - 1;
+		memmove(DSF_WORD(DSF), DSF_WORD(dsf), (2 + argc) * sizeof(REBVAL));
+		DSP = DSF + DSF_SIZE + argc;
+		func = DSF_FUNC(DSF);
+	}
 
+	ds = DS_RETURN;
 	if (IS_ERROR(result) && IS_RETURN(result)) {
 		// Value below is kept safe from GC because no-allocation is
 		// done between point of SET_THROW and here.
@@ -469,3 +949,23 @@
 	}
 	else *ds = *result; // Set return value (atomic)
 }
+
+
+/***********************************************************************
+**
+*/	void Do_Function(REBVAL *func)
+/*
+***********************************************************************/
+{
+	Do_Body(func);
+}
+
+
+/***********************************************************************
+**
+*/	void Do_Closure(REBVAL *func)
+/*
+***********************************************************************/
+{
+	Do_Body(func);
+}
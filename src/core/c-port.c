@@ -247,6 +247,13 @@
 
 		//printf("%d %d %d\n", dt, time, timeout);
 
+		// Use the time for a slice of incremental recycle, if any:
+		if (GC_Slice && GC_Active && !GC_Disabled
+			&& (GC_Phase || GC_Ballast < VAL_INT32(TASK_BALLAST) / 2)) {
+			Recycle_Slice();
+			continue;
+		}
+
 		// Wait for events or time to expire:
 		//Debug_Num("OSW", wt);
 		OS_WAIT(wt, res);
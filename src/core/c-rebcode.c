@@ -0,0 +1,827 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  c-rebcode.c
+**  Summary: rebcode virtual machine
+**  Section: core
+**  Author:  REBOL Technologies
+**  Notes:
+**
+***********************************************************************/
+/*
+		A REBCODE function is called like any other function, but its
+		body is not evaluated by DO. The body is a block of simple
+		instructions (the rebcode dialect) that is assembled and
+		verified once, when the function is made, into a code array.
+
+		The registers of the machine are the argument and local
+		variable slots of the function's own stack frame, so the
+		function spec defines them:
+
+			sum: rebcode [n [integer!] /local acc] [
+				set.i acc 0
+				label loop
+				add.i acc n
+				sub.i n 1
+				gt.i n 0
+				brat loop
+				return acc
+			]
+
+		The function body holds (see RCB_ indexes):
+
+			1. The source block (for MOLD and BODY-OF)
+			2. A binary holding the code array (of REBINTs)
+			3. A block holding the literal values used by the code
+
+		Each instruction is an opcode followed by its operands. An
+		operand is a register number (> 0) or the negated index of a
+		literal value (< 0). Branch operands are code offsets.
+
+		Operand kinds (see Rebcode_Defs):
+
+			r - register (a word of the function frame)
+			v - any value (register or literal)
+			i - integer (register or literal)
+			d - number (register or integer/decimal literal)
+			s - series (register or literal)
+			l - label (branch target)
+			w - word of a function to call
+			b - block of argument values for the call
+
+		The assembler verifies operand kinds and labels. Register
+		datatypes can change, so typed instructions also check
+		them at run time.
+*/
+
+#include "sys-core.h"
+
+extern const REBDOF Func_Dispatch[];
+
+enum {
+	RCB_SOURCE,
+	RCB_CODE,
+	RCB_CONSTS,
+	RCB_MAX
+};
+
+enum Rebcode_Ops {
+	RC_END = 0,
+	RC_LABEL,		// pseudo-op, never emitted
+	RC_SET,
+	RC_SET_I,
+	RC_SET_D,
+	RC_ADD_I,
+	RC_SUB_I,
+	RC_MUL_I,
+	RC_DIV_I,
+	RC_REM_I,
+	RC_AND_I,
+	RC_OR_I,
+	RC_XOR_I,
+	RC_SHL_I,
+	RC_SHR_I,
+	RC_NEG_I,
+	RC_ADD_D,
+	RC_SUB_D,
+	RC_MUL_D,
+	RC_DIV_D,
+	RC_NEG_D,
+	RC_TO_I,
+	RC_TO_D,
+	RC_EQ_I,
+	RC_NE_I,
+	RC_LT_I,
+	RC_LTEQ_I,
+	RC_GT_I,
+	RC_GTEQ_I,
+	RC_EQ_D,
+	RC_NE_D,
+	RC_LT_D,
+	RC_LTEQ_D,
+	RC_GT_D,
+	RC_GTEQ_D,
+	RC_BRA,
+	RC_BRAT,
+	RC_BRAF,
+	RC_LENGTH,
+	RC_INDEX,
+	RC_SKIP,
+	RC_PICK,
+	RC_POKE,
+	RC_APPEND,
+	RC_APPLY,
+	RC_RETURN,
+	RC_MAX
+};
+
+static const struct {
+	const char *name;
+	const char *args;
+} Rebcode_Defs[RC_MAX] = {
+	{0,			""},
+	{"label",	""},
+	{"set",		"rv"},
+	{"set.i",	"ri"},
+	{"set.d",	"rd"},
+	{"add.i",	"ri"},
+	{"sub.i",	"ri"},
+	{"mul.i",	"ri"},
+	{"div.i",	"ri"},
+	{"rem.i",	"ri"},
+	{"and.i",	"ri"},
+	{"or.i",	"ri"},
+	{"xor.i",	"ri"},
+	{"shl.i",	"ri"},
+	{"shr.i",	"ri"},
+	{"neg.i",	"r"},
+	{"add.d",	"rd"},
+	{"sub.d",	"rd"},
+	{"mul.d",	"rd"},
+	{"div.d",	"rd"},
+	{"neg.d",	"r"},
+	{"to.i",	"rd"},
+	{"to.d",	"rd"},
+	{"eq.i",	"ii"},
+	{"ne.i",	"ii"},
+	{"lt.i",	"ii"},
+	{"lteq.i",	"ii"},
+	{"gt.i",	"ii"},
+	{"gteq.i",	"ii"},
+	{"eq.d",	"dd"},
+	{"ne.d",	"dd"},
+	{"lt.d",	"dd"},
+	{"lteq.d",	"dd"},
+	{"gt.d",	"dd"},
+	{"gteq.d",	"dd"},
+	{"bra",		"l"},
+	{"brat",	"l"},
+	{"braf",	"l"},
+	{"length",	"rs"},
+	{"index",	"rs"},
+	{"skip",	"ri"},
+	{"pick",	"rsi"},
+	{"poke",	"siv"},
+	{"append",	"sv"},
+	{"apply",	"rwb"},
+	{"return",	"v"},
+};
+
+static REBCNT Rebcode_Syms[RC_MAX];	// canon symbols of opcode words
+
+#define OPND(n) ((n) > 0 ? regs + (n) : consts - (n))
+
+
+/***********************************************************************
+**
+*/	void Init_Rebcode(void)
+/*
+**		Create the symbols used by the rebcode assembler.
+**
+***********************************************************************/
+{
+	REBCNT n;
+
+	for (n = RC_LABEL; n < RC_MAX; n++)
+		Rebcode_Syms[n] = SYMBOL_TO_CANON(Make_Word((REBYTE*)Rebcode_Defs[n].name, LEN_BYTES((REBYTE*)Rebcode_Defs[n].name)));
+}
+
+
+/***********************************************************************
+**
+*/	static void Trap_Rebcode(REBVAL *value)
+/*
+**		Invalid rebcode dialect usage at the given value.
+**
+***********************************************************************/
+{
+	Trap_Word(RE_DIALECT, SYM_REBCODE, value);
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Find_Opcode(REBVAL *word)
+/*
+***********************************************************************/
+{
+	REBCNT sym = VAL_WORD_CANON(word);
+	REBINT n;
+
+	for (n = RC_LABEL; n < RC_MAX; n++)
+		if (Rebcode_Syms[n] == sym) return n;
+
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Find_Label(REBSER *labels, REBVAL *word)
+/*
+**		Labels block holds word and integer offset pairs.
+**		Returns the code offset, or -1 if not found.
+**
+***********************************************************************/
+{
+	REBVAL *val;
+
+	for (val = BLK_HEAD(labels); NOT_END(val); val += 2)
+		if (VAL_WORD_CANON(val) == VAL_WORD_CANON(word)) return VAL_INT32(val+1);
+
+	return -1;
+}
+
+
+/***********************************************************************
+**
+*/	static void Emit_Code(REBSER *code, REBINT n)
+/*
+***********************************************************************/
+{
+	REBCNT tail = SERIES_TAIL(code);
+
+	EXPAND_SERIES_TAIL(code, sizeof(REBINT));
+	*(REBINT *)BIN_SKIP(code, tail) = n;
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Emit_Const(REBSER *consts, REBVAL *value)
+/*
+**		Add a literal value. Returns its (negated) operand number.
+**
+***********************************************************************/
+{
+	Append_Val(consts, value);
+	return -(REBINT)(SERIES_TAIL(consts) - 1);
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Get_Operand(REBSER *args, REBSER *consts, REBVAL *value, REBYTE kind)
+/*
+**		Verify an operand of the given kind and return its operand
+**		number. Words must be registers. Lit-words are literals.
+**
+***********************************************************************/
+{
+	REBCNT n;
+	REBVAL word;
+
+	if (IS_WORD(value)) {
+		n = Find_Arg_Index(args, VAL_WORD_SYM(value));
+		if (!n) Trap_Rebcode(value);
+		return n;
+	}
+
+	if (kind == 'r') Trap_Rebcode(value);
+
+	switch (kind) {
+	case 'v':
+		if (IS_LIT_WORD(value)) {
+			word = *value;
+			VAL_SET(&word, REB_WORD);
+			return Emit_Const(consts, &word);
+		}
+		if (ANY_WORD(value) || ANY_PATH(value) || IS_PAREN(value)) break;
+		return Emit_Const(consts, value);
+	case 'i':
+		if (IS_INTEGER(value)) return Emit_Const(consts, value);
+		break;
+	case 'd':
+		if (IS_INTEGER(value) || IS_DECIMAL(value)) return Emit_Const(consts, value);
+		break;
+	case 's':
+		if (ANY_SERIES(value) && !ANY_PATH(value)) return Emit_Const(consts, value);
+		break;
+	}
+
+	Trap_Rebcode(value);
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Assemble_Rebcode(REBSER *args, REBSER *source)
+/*
+**		Assemble and verify the source block of a rebcode function.
+**		Returns the function body block (see RCB_ indexes).
+**
+***********************************************************************/
+{
+	REBSER *body;
+	REBSER *code;
+	REBSER *consts;
+	REBSER *labels;
+	REBVAL *value;
+	REBVAL *val;
+	REBINT op;
+	REBINT pc;
+	REBINT n;
+	const char *kinds;
+
+	labels = Make_Block(8);
+
+	// Pass 1: verify opcodes and operand counts, and find labels:
+	pc = 0;
+	for (value = BLK_HEAD(source); NOT_END(value);) {
+		op = IS_WORD(value) ? Find_Opcode(value) : 0;
+		if (!op) Trap_Rebcode(value);
+		if (op == RC_LABEL) {
+			value++;
+			if (!IS_WORD(value) || Find_Label(labels, value) >= 0) Trap_Rebcode(value);
+			Append_Val(labels, value);
+			val = Append_Value(labels);
+			SET_INTEGER(val, pc);
+			value++;
+			continue;
+		}
+		pc++;
+		for (kinds = Rebcode_Defs[op].args; *kinds; kinds++) {
+			if (IS_END(++value)) Trap_Rebcode(value-1);
+			if (*kinds == 'b') {
+				if (!IS_BLOCK(value)) Trap_Rebcode(value);
+				pc += VAL_LEN(value);
+			}
+			pc++;
+		}
+		value++;
+	}
+
+	code = Make_Binary((pc + 1) * sizeof(REBINT));
+	consts = Make_Block(8);
+	SET_NONE(Append_Value(consts)); // literals start at index 1
+
+	// Pass 2: emit the code:
+	for (value = BLK_HEAD(source); NOT_END(value);) {
+		op = Find_Opcode(value++);
+		if (op == RC_LABEL) {
+			value++;
+			continue;
+		}
+		Emit_Code(code, op);
+		for (kinds = Rebcode_Defs[op].args; *kinds; kinds++, value++) {
+			switch (*kinds) {
+			case 'l':
+				n = IS_WORD(value) ? Find_Label(labels, value) : -1;
+				if (n < 0) Trap_Rebcode(value);
+				Emit_Code(code, n);
+				break;
+			case 'w':
+				if (!IS_WORD(value)) Trap_Rebcode(value);
+				Emit_Code(code, Emit_Const(consts, value));
+				break;
+			case 'b':
+				Emit_Code(code, VAL_LEN(value));
+				for (val = VAL_BLK_DATA(value); NOT_END(val); val++)
+					Emit_Code(code, Get_Operand(args, consts, val, 'v'));
+				break;
+			default:
+				Emit_Code(code, Get_Operand(args, consts, value, *kinds));
+			}
+		}
+	}
+	Emit_Code(code, RC_END);
+
+	body = Make_Block(RCB_MAX);
+	Set_Block(Append_Value(body), source);
+	Set_Binary(Append_Value(body), code);
+	Set_Block(Append_Value(body), consts);
+
+	return body;
+}
+
+
+/***********************************************************************
+**
+*/	REBFLG Make_Rebcode(REBVAL *value)
+/*
+**		Assemble the body of a new rebcode function. The value has
+**		its spec, args, and source body already set.
+**
+***********************************************************************/
+{
+	VAL_FUNC_BODY(value) = Assemble_Rebcode(VAL_FUNC_ARGS(value), VAL_FUNC_BODY(value));
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Rebcode_Source(REBVAL *value)
+/*
+**		Return the source block of a rebcode function.
+**
+***********************************************************************/
+{
+	return VAL_SERIES(BLK_SKIP(VAL_FUNC_BODY(value), RCB_SOURCE));
+}
+
+
+/***********************************************************************
+**
+*/	static REBI64 Int_Arg(REBVAL *arg)
+/*
+***********************************************************************/
+{
+	if (!IS_INTEGER(arg)) Trap_Type(arg);
+	return VAL_INT64(arg);
+}
+
+
+/***********************************************************************
+**
+*/	static REBDEC Dec_Arg(REBVAL *arg)
+/*
+***********************************************************************/
+{
+	if (IS_DECIMAL(arg)) return VAL_DECIMAL(arg);
+	if (!IS_INTEGER(arg)) Trap_Type(arg);
+	return (REBDEC)VAL_INT64(arg);
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Series_Arg(REBVAL *arg)
+/*
+**		Strings, binary and blocks only. Other series (image, vector)
+**		do not hold chars or values, so PICK and POKE cannot use them.
+**
+***********************************************************************/
+{
+	if (!ANY_BINSTR(arg) && !ANY_BLOCK(arg)) Trap_Type(arg);
+	return VAL_SERIES(arg);
+}
+
+
+/***********************************************************************
+**
+*/	static REBVAL *Apply_Rebcode(REBSER *where, REBINT *ip, REBVAL *consts)
+/*
+**		Call a function from rebcode. The ip points to the function
+**		word operand, followed by the arg count and arg operands.
+**		Result is volatile - a stack value above the DSP.
+**
+***********************************************************************/
+{
+	REBVAL *word = consts - ip[0];
+	REBINT count = ip[1];
+	REBVAL *func;
+	REBVAL *regs;
+	REBVAL *args;
+	REBVAL *val;
+	REBCNT dsf;
+
+	func = Get_Var(word);
+	if (!ANY_FUNC(func)) Trap1(RE_NO_VALUE, word);
+
+	if ((DSP + count + 20) > (REBINT)SERIES_REST(DS_Series)) Expand_Stack(STACK_MIN);
+	regs = DSF_ARGS(DSF, 0);
+
+	dsf = Push_Func(FALSE, where, 0, VAL_WORD_SYM(word), func);
+	func = DSF_FUNC(dsf);
+
+	// Push args in order. Refinements and their args are not used:
+	ip += 2;
+	for (args = BLK_SKIP(VAL_FUNC_WORDS(func), 1); NOT_END(args); args++) {
+		if (count > 0 && !IS_REFINEMENT(args)) {
+			val = OPND(*ip);
+			if (!TYPE_CHECK(args, VAL_TYPE(val)))
+				Trap3(RE_EXPECT_ARG, word, args, Of_Type(val));
+			DS_PUSH(val);
+			ip++;
+			count--;
+		}
+		else {
+			if (!IS_REFINEMENT(args) && !count) Trap2(RE_NO_ARG, word, args);
+			break;
+		}
+	}
+	if (count > 0) Trap_Arg(word);
+	for (; NOT_END(args); args++) DS_PUSH_NONE;
+
+	DSF = dsf;
+	Func_Dispatch[VAL_TYPE(func) - REB_NATIVE](func);
+	DSF = PRIOR_DSF(dsf);
+	DSP = dsf-1;
+
+	return DS_VALUE(dsf);
+}
+
+
+/***********************************************************************
+**
+*/	void Do_Rebcode(REBVAL *func)
+/*
+**		Run the code of a rebcode function. The frame args
+**		and locals are the registers.
+**
+***********************************************************************/
+{
+	REBSER *body = VAL_FUNC_BODY(func);
+	REBINT *code = (REBINT *)VAL_BIN(BLK_SKIP(body, RCB_CODE));
+	REBVAL *consts = VAL_BLK(BLK_SKIP(body, RCB_CONSTS));
+	REBVAL *regs = DSF_ARGS(DSF, 0);
+	REBINT *ip = code;
+	REBFLG cond = FALSE;
+	REBVAL *dst;
+	REBVAL *val;
+	REBSER *ser;
+	REBI64 num;
+	REBI64 arg;
+	REBDEC dnum;
+
+	Eval_Functions++;
+	CHECK_STACK(&ip);
+
+	while (TRUE) {
+		switch (*ip++) {
+
+		case RC_SET:
+			regs[ip[0]] = *OPND(ip[1]);
+			ip += 2;
+			break;
+
+		case RC_SET_I:
+			num = Int_Arg(OPND(ip[1]));
+			SET_INTEGER(regs + ip[0], num);
+			ip += 2;
+			break;
+
+		case RC_SET_D:
+			dnum = Dec_Arg(OPND(ip[1]));
+			SET_DECIMAL(regs + ip[0], dnum);
+			ip += 2;
+			break;
+
+		//-- Integer math:
+		case RC_ADD_I:
+			dst = regs + ip[0];
+			num = Int_Arg(dst);
+			arg = Int_Arg(OPND(ip[1]));
+			VAL_INT64(dst) = (REBU64)num + (REBU64)arg;
+			if (((num < 0) == (arg < 0)) && ((num < 0) != (VAL_INT64(dst) < 0)))
+				Trap0(RE_OVERFLOW);
+			ip += 2;
+			break;
+
+		case RC_SUB_I:
+			dst = regs + ip[0];
+			num = Int_Arg(dst);
+			arg = Int_Arg(OPND(ip[1]));
+			VAL_INT64(dst) = (REBU64)num - (REBU64)arg;
+			if (((num < 0) != (arg < 0)) && ((num < 0) != (VAL_INT64(dst) < 0)))
+				Trap0(RE_OVERFLOW);
+			ip += 2;
+			break;
+
+		case RC_MUL_I:
+			dst = regs + ip[0];
+			VAL_INT64(dst) = Mul_Int(Int_Arg(dst), Int_Arg(OPND(ip[1])));
+			ip += 2;
+			break;
+
+		case RC_DIV_I:
+		case RC_REM_I:
+			dst = regs + ip[0];
+			num = Int_Arg(dst);
+			arg = Int_Arg(OPND(ip[1]));
+			if (arg == 0) Trap0(RE_ZERO_DIVIDE);
+			if (num == MIN_I64 && arg == -1) {
+				if (ip[-1] == RC_DIV_I) Trap0(RE_OVERFLOW);
+				VAL_INT64(dst) = 0;
+			}
+			else VAL_INT64(dst) = (ip[-1] == RC_DIV_I) ? num / arg : num % arg;
+			ip += 2;
+			break;
+
+		case RC_AND_I:
+			dst = regs + ip[0];
+			VAL_INT64(dst) = Int_Arg(dst) & Int_Arg(OPND(ip[1]));
+			ip += 2;
+			break;
+
+		case RC_OR_I:
+			dst = regs + ip[0];
+			VAL_INT64(dst) = Int_Arg(dst) | Int_Arg(OPND(ip[1]));
+			ip += 2;
+			break;
+
+		case RC_XOR_I:
+			dst = regs + ip[0];
+			VAL_INT64(dst) = Int_Arg(dst) ^ Int_Arg(OPND(ip[1]));
+			ip += 2;
+			break;
+
+		case RC_SHL_I:
+		case RC_SHR_I:
+			dst = regs + ip[0];
+			num = Int_Arg(dst);
+			arg = Int_Arg(OPND(ip[1]));
+			if (arg < 0 || arg > 63) Trap_Range(OPND(ip[1]));
+			VAL_INT64(dst) = (ip[-1] == RC_SHL_I) ? (REBI64)((REBU64)num << arg) : num >> arg;
+			ip += 2;
+			break;
+
+		case RC_NEG_I:
+			dst = regs + ip[0];
+			num = Int_Arg(dst);
+			if (num == MIN_I64) Trap0(RE_OVERFLOW);
+			VAL_INT64(dst) = -num;
+			ip++;
+			break;
+
+		//-- Decimal math:
+		case RC_ADD_D:
+			dst = regs + ip[0];
+			SET_DECIMAL(dst, Dec_Arg(dst) + Dec_Arg(OPND(ip[1])));
+			ip += 2;
+			break;
+
+		case RC_SUB_D:
+			dst = regs + ip[0];
+			SET_DECIMAL(dst, Dec_Arg(dst) - Dec_Arg(OPND(ip[1])));
+			ip += 2;
+			break;
+
+		case RC_MUL_D:
+			dst = regs + ip[0];
+			SET_DECIMAL(dst, Dec_Arg(dst) * Dec_Arg(OPND(ip[1])));
+			ip += 2;
+			break;
+
+		case RC_DIV_D:
+			dst = regs + ip[0];
+			dnum = Dec_Arg(OPND(ip[1]));
+			if (dnum == 0.0) Trap0(RE_ZERO_DIVIDE);
+			SET_DECIMAL(dst, Dec_Arg(dst) / dnum);
+			ip += 2;
+			break;
+
+		case RC_NEG_D:
+			dst = regs + ip[0];
+			SET_DECIMAL(dst, -Dec_Arg(dst));
+			ip++;
+			break;
+
+		case RC_TO_I:
+			dnum = Dec_Arg(OPND(ip[1]));
+			if (dnum < MIN_D64 || dnum >= MAX_D64) Trap0(RE_OVERFLOW);
+			SET_INTEGER(regs + ip[0], (REBI64)dnum);
+			ip += 2;
+			break;
+
+		case RC_TO_D:
+			dnum = Dec_Arg(OPND(ip[1]));
+			SET_DECIMAL(regs + ip[0], dnum);
+			ip += 2;
+			break;
+
+		//-- Compares (set the condition flag):
+		case RC_EQ_I:	cond = Int_Arg(OPND(ip[0])) == Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_NE_I:	cond = Int_Arg(OPND(ip[0])) != Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_LT_I:	cond = Int_Arg(OPND(ip[0])) <  Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_LTEQ_I:	cond = Int_Arg(OPND(ip[0])) <= Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_GT_I:	cond = Int_Arg(OPND(ip[0])) >  Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_GTEQ_I:	cond = Int_Arg(OPND(ip[0])) >= Int_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_EQ_D:	cond = Dec_Arg(OPND(ip[0])) == Dec_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_NE_D:	cond = Dec_Arg(OPND(ip[0])) != Dec_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_LT_D:	cond = Dec_Arg(OPND(ip[0])) <  Dec_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_LTEQ_D:	cond = Dec_Arg(OPND(ip[0])) <= Dec_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_GT_D:	cond = Dec_Arg(OPND(ip[0])) >  Dec_Arg(OPND(ip[1])); ip += 2; break;
+		case RC_GTEQ_D:	cond = Dec_Arg(OPND(ip[0])) >= Dec_Arg(OPND(ip[1])); ip += 2; break;
+
+		//-- Branches:
+		case RC_BRAT:
+			if (!cond) {ip++; break;}
+			goto branch;
+		case RC_BRAF:
+			if (cond) {ip++; break;}
+		case RC_BRA:
+		branch:
+			// Backward branches are loops, so they must allow signals:
+			if (code + ip[0] < ip) {
+				if (--Eval_Count <= 0 || Eval_Signals) Do_Signals();
+			}
+			ip = code + ip[0];
+			break;
+
+		//-- Series:
+		case RC_LENGTH:
+			val = OPND(ip[1]);
+			Series_Arg(val);
+			SET_INTEGER(regs + ip[0], VAL_LEN(val));
+			ip += 2;
+			break;
+
+		case RC_INDEX:
+			val = OPND(ip[1]);
+			Series_Arg(val);
+			SET_INTEGER(regs + ip[0], VAL_INDEX(val) + 1);
+			ip += 2;
+			break;
+
+		case RC_SKIP:
+			dst = regs + ip[0];
+			ser = Series_Arg(dst);
+			num = VAL_INDEX(dst) + Int_Arg(OPND(ip[1]));
+			if (num < 0) num = 0;
+			else if (num > (REBI64)SERIES_TAIL(ser)) num = SERIES_TAIL(ser);
+			VAL_INDEX(dst) = (REBCNT)num;
+			ip += 2;
+			break;
+
+		case RC_PICK:
+			val = OPND(ip[1]);
+			ser = Series_Arg(val);
+			num = VAL_INDEX(val) + Int_Arg(OPND(ip[2])) - 1;
+			dst = regs + ip[0];
+			if (num < 0 || num >= (REBI64)SERIES_TAIL(ser)) SET_NONE(dst);
+			else if (ANY_BLOCK(val)) *dst = *BLK_SKIP(ser, num);
+			else if (IS_BINARY(val)) SET_INTEGER(dst, BIN_HEAD(ser)[num]);
+			else SET_CHAR(dst, GET_ANY_CHAR(ser, (REBCNT)num));
+			ip += 3;
+			break;
+
+		case RC_POKE:
+			val = OPND(ip[0]);
+			ser = Series_Arg(val);
+			TRAP_PROTECT(ser);
+			num = VAL_INDEX(val) + Int_Arg(OPND(ip[1])) - 1;
+			if (num < 0 || num >= (REBI64)SERIES_TAIL(ser)) Trap_Range(OPND(ip[1]));
+			val = OPND(ip[2]);
+			if (ANY_BLOCK(OPND(ip[0]))) {
+				UNCOMPILE_BLOCK(ser);
+				REMEMBER_SERIES(ser);
+				*BLK_SKIP(ser, num) = *val;
+			}
+			else {
+				if (IS_CHAR(val)) arg = VAL_CHAR(val);
+				else {
+					if (!IS_INTEGER(val)) Trap_Type(val);
+					arg = VAL_INT64(val);
+				}
+				if (arg < 0 || arg > (IS_BINARY(OPND(ip[0])) ? 0xff : MAX_CHAR)) Trap_Range(val);
+				if (BYTE_SIZE(ser) && arg > 0xff) Widen_String(ser);
+				SET_ANY_CHAR(ser, (REBCNT)num, (REBUNI)arg);
+			}
+			ip += 3;
+			break;
+
+		case RC_APPEND:
+			val = OPND(ip[0]);
+			ser = Series_Arg(val);
+			if (!ANY_BLOCK(val)) Trap_Type(val);
+			TRAP_PROTECT(ser);
+			Append_Val(ser, OPND(ip[1]));
+			ip += 2;
+			break;
+
+		//-- Calls:
+		case RC_APPLY:
+			val = Apply_Rebcode(VAL_SERIES(BLK_SKIP(body, RCB_SOURCE)), ip + 1, consts);
+			regs = DSF_ARGS(DSF, 0); // stack may have expanded
+			if (THROWN(val)) {
+				*DS_RETURN = *val;
+				return;
+			}
+			regs[ip[0]] = *val;
+			ip += 3 + ip[2];
+			break;
+
+		case RC_RETURN:
+			*DS_RETURN = *OPND(ip[0]);
+			return;
+
+		case RC_END:
+			SET_UNSET(DS_RETURN);
+			return;
+
+		default:
+			Crash(RP_MISC);
+		}
+	}
+}
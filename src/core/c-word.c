@@ -39,6 +39,10 @@
 **    NEVER CACHE A WORD NAME POINTER if new words may be added (e.g.
 **    LOAD), because the series may get moved in memory.
 **
+**    Words are only added, so other threads can search for them
+**    without a lock. The old memory of an expanded table is kept
+**    (see Expand_Word_Table), as they may still be reading it.
+**
 ***********************************************************************/
 
 #include "sys-core.h"
@@ -46,6 +50,24 @@
 
 #define WORD_TABLE_SIZE 1024  // initial size in words
 
+// A slot of the word hash table holds a canon word and its full hash,
+// so other words are passed over without comparing their names:
+typedef struct Reb_Word_Slot {
+	REBCNT	sym;
+	REBCNT	hash;
+} WORD_SLOT;
+
+// The word hash table (replaced by a larger one, not expanded):
+typedef struct Reb_Word_Hash {
+	REBCNT	size;		// Number of slots (a prime)
+	WORD_SLOT slots[1];	// (size of them)
+} WORD_HASH;
+
+static REBCNT Word_Lock;	// Held to add words (see Make_Word)
+
+#define LOCK_WORDS()	while (!SWAP_IF(Word_Lock, 0, 1))
+#define UNLOCK_WORDS()	do {RELEASE_FENCE(); STORE_ONCE(REBCNT, Word_Lock, 0);} while (0)
+
 
 /***********************************************************************
 **
@@ -120,6 +142,7 @@
 	oser = *ser;
 	*ser = *nser;
 	ser->info = oser.info;
+	ser->gen = oser.gen;
 	*nser = oser;
 
 	Clear_Series(ser);
@@ -131,40 +154,134 @@
 
 /***********************************************************************
 **
-*/	static void Expand_Word_Table(void)
+*/	static WORD_HASH *Make_Word_Hash(REBCNT size)
 /*
-**		Expand the hash table part of the word_table by allocating
-**		the next larger table size and rehashing all the words of
-**		the current table.  Free the old hash array.
+**		Allocate a clear word hash table of size slots. Returns
+**		zero if there is not enough memory.
 **
 ***********************************************************************/
 {
-	REBCNT *hashes;
-	REBVAL *word;
-	REBINT hash;
-	REBCNT size;
-	REBINT skip;
+	WORD_HASH *table;
+
+	table = Make_Mem(sizeof(WORD_HASH) + (size - 1) * sizeof(WORD_SLOT));
+	if (table) table->size = size;
+	return table;
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Has_Word_Room(REBCNT len)
+/*
+**		Can a word of len bytes be added without expanding the word
+**		table? The hash table is kept at most half full.
+**
+***********************************************************************/
+{
+	return PG_Word_Table.series->tail + 1 < SERIES_REST(PG_Word_Table.series)
+		&& PG_Word_Names->tail + len + 1 < SERIES_REST(PG_Word_Names)
+		&& PG_Word_Table.series->tail < PG_Word_Table.hashes->size / 2;
+}
+
+
+/***********************************************************************
+**
+*/	static void Expand_Word_Table(REBCNT len)
+/*
+**		Make room in the word table for a word of len bytes: more
+**		symbols, more name bytes, or a larger hash table (rehashed
+**		by the kept hashes of its words).
+**
+**		Other threads may be reading the old ones without a lock,
+**		so they are not changed or freed. New ones are made that
+**		take their place. (As each is double the size, what is kept
+**		adds up to less than what is used.) The memory is made with
+**		the lock released, so that a trap cannot leave it held.
+**
+***********************************************************************/
+{
+	REBSER *words = PG_Word_Table.series;
+	REBSER *names = PG_Word_Names;
+	WORD_HASH *table = 0;
+	WORD_SLOT *slot;
+	REBYTE *wdata = 0;
+	REBYTE *ndata = 0;
+	REBCNT wsize = 0;
+	REBCNT nsize = 0;
+	REBCNT hsize = 0;
+	REBCNT index;
+	REBCNT skip;
 	REBCNT n;
 
-	// Allocate a new hash table:
-	Expand_Hash(PG_Word_Table.hashes);
-	// Debug_Fmt("WORD-TABLE: expanded (%d symbols, %d slots)", PG_Word_Table.series->tail, PG_Word_Table.hashes->tail);
-
-	// Rehash all the symbols:
-	word = BLK_SKIP(PG_Word_Table.series, 1);
-	hashes = (REBCNT *)PG_Word_Table.hashes->data;
-	size = PG_Word_Table.hashes->tail;
-	for (n = 1; n < PG_Word_Table.series->tail; n++, word++) {
-		hash = Hash_Word(VAL_SYM_NAME(word), -1);
-		skip  = (hash & 0x0000FFFF) % size;
-		if (skip == 0) skip = 1;
-		hash = (hash & 0x00FFFF00) % size;
-		while (hashes[hash]) {
-			hash += skip;
-			if (hash >= (REBINT)size) hash -= size;
+	LOCK_WORDS();
+	if (words->tail + 1 >= SERIES_REST(words))
+		wsize = SERIES_REST(words) * 2;
+	if (names->tail + len + 1 >= SERIES_REST(names))
+		nsize = MAX(SERIES_REST(names) * 2, names->tail + len + 1024);
+	if (words->tail >= PG_Word_Table.hashes->size / 2)
+		hsize = PG_Word_Table.hashes->size + 1; // (the next prime)
+	UNLOCK_WORDS();
+
+	if (hsize) {
+		n = Get_Hash_Prime(hsize);
+		if (!n) Trap_Num(RE_SIZE_LIMIT, hsize);
+		hsize = n;
+	}
+
+	if (
+		(wsize && !(wdata = Make_Mem(wsize * sizeof(REBVAL))))
+		|| (nsize && !(ndata = Make_Mem(nsize)))
+		|| (hsize && !(table = Make_Word_Hash(hsize)))
+	) {
+		if (wdata) Free_Mem(wdata, wsize * sizeof(REBVAL));
+		if (ndata) Free_Mem(ndata, nsize);
+		Trap0(RE_NO_MEMORY);
+	}
+
+	LOCK_WORDS();
+
+	// (Unless another thread did it first:)
+	if (wdata && wsize > SERIES_REST(words)) {
+		COPY_MEM(wdata, words->data, words->tail * sizeof(REBVAL));
+		RELEASE_FENCE();
+		STORE_ONCE(REBYTE *, words->data, wdata);
+		SERIES_REST(words) = wsize;
+		wdata = 0;
+	}
+
+	if (ndata && nsize > SERIES_REST(names)) {
+		COPY_MEM(ndata, names->data, names->tail);
+		RELEASE_FENCE();
+		STORE_ONCE(REBYTE *, names->data, ndata);
+		SERIES_REST(names) = nsize;
+		ndata = 0;
+	}
+
+	if (table && hsize > PG_Word_Table.hashes->size) {
+		// Rehash all the canon words:
+		slot = PG_Word_Table.hashes->slots;
+		for (n = PG_Word_Table.hashes->size; n > 0; slot++, n--) {
+			if (!slot->sym) continue;
+			index = slot->hash % hsize;
+			skip = (slot->hash >> 16) % hsize;
+			if (skip == 0) skip = 1;
+			while (table->slots[index].sym) {
+				index += skip;
+				if (index >= hsize) index -= hsize;
+			}
+			table->slots[index] = *slot;
 		}
-		hashes[hash] = n;
+		RELEASE_FENCE();
+		STORE_ONCE(WORD_HASH *, PG_Word_Table.hashes, table);
+		table = 0;
+		// Debug_Fmt("WORD-TABLE: expanded (%d symbols, %d slots)", words->tail, hsize);
 	}
+
+	UNLOCK_WORDS();
+
+	if (wdata) Free_Mem(wdata, wsize * sizeof(REBVAL));
+	if (ndata) Free_Mem(ndata, nsize);
+	if (table) Free_Mem(table, sizeof(WORD_HASH) + (hsize - 1) * sizeof(WORD_SLOT));
 }
 
 
@@ -172,18 +289,94 @@
 **
 */	static REBCNT Make_Word_Name(REBYTE *str, REBCNT len)
 /*
-**		Allocates and copies the text string of the word.
+**		Copies the text string of the word (there is room for it).
 **
 ***********************************************************************/
 {
 	REBCNT pos = SERIES_TAIL(PG_Word_Names);
 
-	Append_Mem_Extra(PG_Word_Names, str, len, 1); // so we can do next line...
-	PG_Word_Names->tail++; // keep terminator for each string
+	COPY_MEM(STR_SKIP(PG_Word_Names, pos), str, len);
+	STR_SKIP(PG_Word_Names, pos)[len] = 0; // keep terminator for each string
+	PG_Word_Names->tail += len + 1;
 	return pos;
 }
 
 
+/***********************************************************************
+**
+*/	static REBFLG Same_Name(REBYTE *name, REBYTE *str, REBCNT len)
+/*
+**		Is the (terminated) name the same bytes as the string?
+**
+***********************************************************************/
+{
+	for (; len > 0; len--, name++, str++) {
+		if (*name != *str || !*name) return FALSE;
+	}
+	return !*name;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Sym(REBYTE *str, REBCNT len, REBCNT hash, REBCNT *alias, REBCNT *index)
+/*
+**		Search the hash table for the word. Return its symbol, or
+**		zero if it is not there.
+**
+**		A slot of the hash table is only checked further if it has
+**		the same full hash. Then the canon word and its aliases are
+**		compared by bytes for the exact word, and the canon word by
+**		UTF8 chars for another case of it. If it is another case,
+**		alias is set to the last form of the canon word. Otherwise
+**		it is zero, and index is the free slot for a new canon word.
+**
+**		It takes no lock. A word is found once its slot (or alias)
+**		is set, which Make_Word does after all of it is written.
+**
+***********************************************************************/
+{
+	WORD_HASH *table = LOAD_ONCE(WORD_HASH *, PG_Word_Table.hashes);
+	WORD_SLOT *slot;
+	REBVAL *words;
+	REBYTE *names;
+	REBCNT size;
+	REBCNT skip;
+	REBCNT h;
+	REBCNT a;
+	REBINT n;
+
+	ACQUIRE_FENCE();
+	size = table->size;
+	*index = hash % size;
+	skip = (hash >> 16) % size;
+	if (skip == 0) skip = 1;
+	*alias = 0;
+
+	for (slot = table->slots + *index; NZ(h = LOAD_ONCE(REBCNT, slot->sym)); slot = table->slots + *index) {
+		ACQUIRE_FENCE();
+		if (slot->hash == hash) {
+			words = (REBVAL *)LOAD_ONCE(REBYTE *, PG_Word_Table.series->data);
+			names = LOAD_ONCE(REBYTE *, PG_Word_Names->data);
+			ACQUIRE_FENCE();
+			for (a = h; a; ) {
+				if (Same_Name(names + VAL_SYM_NINDEX(words+a), str, len)) return a; // direct hit
+				*alias = a;
+				a = LOAD_ONCE(REBCNT, VAL_SYM_ALIAS(words+a));
+				ACQUIRE_FENCE();
+			}
+			n = Compare_UTF8(names + VAL_SYM_NINDEX(words+h), str, len);
+			if (n == 0) return h;
+			if (n > 0) return 0; // a new alias for the word
+			*alias = 0;
+		}
+		if ((*index += skip) >= size) *index -= size;
+	}
+
+	return 0;
+}
+
+
 /***********************************************************************
 **
 */	REBCNT Make_Word(REBYTE *str, REBCNT len)
@@ -193,81 +386,60 @@
 **		Length of zero indicates you provided a zero terminated string.
 **		Return the table index for the word (whether found or new).
 **
+**		The tasks of other threads may make words at the same time.
+**		Most words are found, without a lock. Adding one takes the
+**		lock, then searches again, as it may have been added since.
+**
 ***********************************************************************/
 {
-	REBINT	hash;
-	REBINT	size;
-	REBINT	skip;
-	REBINT	n;
+	REBCNT	hash;
+	REBCNT	index;
 	REBCNT	h;
-	REBCNT	*hashes;
-	REBVAL  *words;
+	REBCNT	n;
+	WORD_SLOT *slot;
 	REBVAL  *w;
 
 	//REBYTE *sss = Get_Sym_Name(1);	// (Debugging method)
 
 	if (len == 0) len = LEN_BYTES(str);
 
-	// If hash part of word table is too dense, expand it:
-	if (PG_Word_Table.series->tail > PG_Word_Table.hashes->tail/2)
-		Expand_Word_Table();
-
-	ASSERT((SERIES_TAIL(PG_Word_Table.series) == SERIES_TAIL(Bind_Table)), RP_BIND_TABLE_SIZE);
+	hash = Hash_Word(str, len);
+	//Debug_Fmt("%s hash %d", str, hash);
 
-	// If word symbol part of word table is full, expand it:
-	if (SERIES_FULL(PG_Word_Table.series)) {
-		Extend_Series(PG_Word_Table.series, 256);
-	}
-	if (SERIES_FULL(Bind_Table)) {
-		Extend_Series(Bind_Table, 256);
-		CLEAR_SERIES(Bind_Table);
-	}
+	if (NZ(n = Find_Sym(str, len, hash, &h, &index))) return n;
 
-	size   = (REBINT)PG_Word_Table.hashes->tail;
-	words  = BLK_HEAD(PG_Word_Table.series);
-	hashes = (REBCNT *)PG_Word_Table.hashes->data;
-
-	// Hash the word, including a skip factor for lookup:
-	hash  = Hash_Word(str, len);
-	skip  = (hash & 0x0000FFFF) % size;
-	if (skip == 0) skip = 1;
-	hash = (hash & 0x00FFFF00) % size;
-	//Debug_Fmt("%s hash %d skip %d", str, hash, skip);
-
-	// Search hash table for word match:
-	while (NZ(h = hashes[hash])) {
-		while ((n = Compare_UTF8(VAL_SYM_NAME(words+h), str, len)) >= 0) {
-			//if (Match_String("script", str, len))
-			//	Debug_Fmt("---- %s %d %d\n", VAL_SYM_NAME(&words[h]), n, h);
-			if (n == 0) return h; // direct hit
-			if (VAL_SYM_ALIAS(words+h)) h = VAL_SYM_ALIAS(words+h);
-			else goto make_sym; // Create new alias for word
+	for (;;) {
+		LOCK_WORDS();
+		if (NZ(n = Find_Sym(str, len, hash, &h, &index))) {
+			UNLOCK_WORDS();
+			return n;
 		}
-		hash += skip;
-		if (hash >= size) hash -= size;
+		if (Has_Word_Room(len)) break;
+		UNLOCK_WORDS();
+		Expand_Word_Table(len);
 	}
 
-make_sym:
 	n = PG_Word_Table.series->tail;
-	w = words + n;
-	if (h) {
-		// Alias word (h = canon word)
-		VAL_SYM_ALIAS(words+h) = n;
-		VAL_SYM_CANON(w) = VAL_SYM_CANON(words+h);
-	} else {
-		// Canon (base version of) word (h == 0)
-		hashes[hash] = n;
-		VAL_SYM_CANON(w) = n;
-	}
+	w = BLK_SKIP(PG_Word_Table.series, n);
+	// Alias word (h = last form of the canon word), or canon word:
+	VAL_SYM_CANON(w) = h ? VAL_SYM_CANON(BLK_SKIP(PG_Word_Table.series, h)) : n;
 	VAL_SYM_ALIAS(w) = 0;
 	VAL_SYM_NINDEX(w) = Make_Word_Name(str, len);
 	VAL_SET(w, REB_HANDLE);
-
-	// These are allowed because of the SERIES_FULL checks above which
-	// add one extra to the TAIL check comparision. However, their
-	// termination values (nulls) will be missing.
+	// Its termination value (null) is missing, as was always so.
 	PG_Word_Table.series->tail++;
-	Bind_Table->tail++;
+
+	// Now that all of it is written, it can be found:
+	RELEASE_FENCE();
+	if (h) STORE_ONCE(REBCNT, VAL_SYM_ALIAS(BLK_SKIP(PG_Word_Table.series, h)), n);
+	else {
+		slot = PG_Word_Table.hashes->slots + index;
+		slot->hash = hash;
+		RELEASE_FENCE();
+		STORE_ONCE(REBCNT, slot->sym, n);
+	}
+
+	UNLOCK_WORDS();
 
 	return n;
 }
@@ -387,37 +559,29 @@ make_sym:
 
 /***********************************************************************
 **
-*/	void Init_Words(REBFLG only)
+*/	void Init_Words(void)
 /*
-**		Only flags BIND_Table creation only (for threads).
+**		The symbol table is shared by all tasks. (Each task has a
+**		bind table of its own, see Init_Frame.)
 **
 ***********************************************************************/
 {
 	REBCNT n = Get_Hash_Prime(WORD_TABLE_SIZE * 4); // extra to reduce rehashing
 
-	if (!only) {
-		// Create the hash for locating words quickly:
-		// Note that the TAIL is never changed for this series.
-		PG_Word_Table.hashes = Make_Series(n+1, sizeof(REBCNT), FALSE);
-		KEEP_SERIES(PG_Word_Table.hashes, "word hashes"); // pointer array
-		Clear_Series(PG_Word_Table.hashes);
-		PG_Word_Table.hashes->tail = n;
-
-		// The word (symbol) table itself:
-		PG_Word_Table.series = Make_Block(WORD_TABLE_SIZE);
-		SET_NONE(BLK_HEAD(PG_Word_Table.series)); // Put a NONE at head.
-		KEEP_SERIES(PG_Word_Table.series, "word table"); // words are never GC'd
-		BARE_SERIES(PG_Word_Table.series); // don't bother to GC scan it
-		PG_Word_Table.series->tail = 1;  // prevent the zero case
-
-		// A normal char array to hold symbol names:
-		PG_Word_Names = Make_Binary(6 * WORD_TABLE_SIZE); // average word size
-		KEEP_SERIES(PG_Word_Names, "word names");
-	}
-
-	// The bind table. Used to cache context indexes for given symbols.
-	Bind_Table = Make_Series(SERIES_REST(PG_Word_Table.series), 4, FALSE);
-	KEEP_SERIES(Bind_Table, "bind table"); // numeric table
-	CLEAR_SERIES(Bind_Table);
-	Bind_Table->tail = PG_Word_Table.series->tail;
+	// Create the hash for locating words quickly:
+	PG_Word_Table.hashes = Make_Word_Hash(n);
+	if (!PG_Word_Table.hashes) Crash(RP_NO_MEMORY, n);
+
+	// The word (symbol) table itself:
+	PG_Word_Table.series = Make_Block(WORD_TABLE_SIZE);
+	SET_NONE(BLK_HEAD(PG_Word_Table.series)); // Put a NONE at head.
+	KEEP_SERIES(PG_Word_Table.series, "word table"); // words are never GC'd
+	BARE_SERIES(PG_Word_Table.series); // don't bother to GC scan it
+	SERIES_SET_FLAG(PG_Word_Table.series, SER_EXT); // data is expanded here
+	PG_Word_Table.series->tail = 1;  // prevent the zero case
+
+	// A normal char array to hold symbol names:
+	PG_Word_Names = Make_Binary(6 * WORD_TABLE_SIZE); // average word size
+	KEEP_SERIES(PG_Word_Names, "word names");
+	SERIES_SET_FLAG(PG_Word_Names, SER_EXT);
 }
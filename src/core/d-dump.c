@@ -306,12 +306,12 @@ xx*/	void Dump_Bind_Table()
 ***********************************************************************/
 {
 	REBCNT	n;
-	REBINT *binds = WORDS_HEAD(Bind_Table);
+	REBBND *binds = BIND_SLOTS(Bind_Table);
 
-	Debug_Fmt("Bind Table (Size: %d)", SERIES_TAIL(Bind_Table));
-	for (n = 1; n < SERIES_TAIL(Bind_Table); n++) {
-		if (binds[n])
-			Debug_Fmt("Bind: %3d to %3d (%s)", n, binds[n], Get_Sym_Name(n));
+	Debug_Fmt("Bind Table (Size: %d Count: %d)", SERIES_TAIL(Bind_Table), Bind_Count);
+	for (n = 0; n < SERIES_TAIL(Bind_Table); n++) {
+		if (binds[n].mark == Bind_Mark && binds[n].index)
+			Debug_Fmt("Bind: %3d to %3d (%s)", binds[n].canon, binds[n].index, Get_Sym_Name(binds[n].canon));
 	}
 }
 #endif
@@ -0,0 +1,528 @@
+/***********************************************************************
+**
+**  REBOL [R3] Language Interpreter and Run-time Environment
+**
+**  Copyright 2012 REBOL Technologies
+**  REBOL is a trademark of REBOL Technologies
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**  http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+**
+************************************************************************
+**
+**  Module:  d-profile.c
+**  Summary: sampling and memory profiler
+**  Section: debug
+**  Author:  Carl Sassenrath
+**  Notes:
+**		While PROFILE runs a block, the evaluation countdown of
+**		Do_Next is set to the sample rate, and each time it runs
+**		out Do_Signals calls Sample_Stack to record the words of
+**		the function frames (the DSF chain) that are active.
+**
+**		A sample counts evaluation steps, not CPU time: a native
+**		that runs long without evaluating (SORT) is not seen,
+**		but those that evaluate blocks (LOOP, EITHER) are.
+**
+**		Each distinct stack is kept once, with its count, in
+**		Prof_Stacks as REBCNT units: count, depth, then the
+**		symbols from outermost (PROFILE itself) to innermost.
+**		Prof_Hash finds them by their symbols.
+**
+**		With /memory, Make_Series calls Count_Series instead, to
+**		count each series to the word of the innermost frame (the
+**		native that made it, as a rule) and the FUNCTION! or
+**		CLOSURE! it was called from (a site, in Prof_Sites). The site number is kept in
+**		the series (GEN_SITE), so that at the end, after a recycle,
+**		the series still alive are counted to their sites too.
+**
+***********************************************************************/
+
+#include "sys-core.h"
+
+#define PROF_RATE	1000	// default evaluations per sample
+#define PROF_DEPTH	256		// innermost frames recorded per sample
+#define PROF_HASH	1024	// initial hash table size (power of 2)
+
+#define SITE_HASH	256		// initial site hash table size (power of 2)
+#define SITE_MAX	0xffffff	// highest site number kept in a series
+
+#define PROF_REC(n)	((REBCNT *)(Prof_Stacks->data) + (n))
+#define PROF_SITE(s,n)	((REBSITE *)((s)->data) + (n))
+
+typedef struct Reb_Site {
+	REBCNT word;		// word of the frame that made the series
+	REBCNT func;		// function! or closure! it ran in (or zero)
+	REBCNT made;		// series made
+	REBCNT live;		// series still alive at the end
+	REBI64 bytes;		// bytes they had when made
+	REBI64 live_bytes;	// bytes of those alive, at the end
+} REBSITE;
+
+
+/***********************************************************************
+**
+*/	static REBCNT Hash_Stack(REBCNT *syms, REBCNT depth)
+/*
+***********************************************************************/
+{
+	REBCNT hash = 2166136261u; // FNV-1a
+
+	for (; depth > 0; depth--, syms++) hash = (hash ^ *syms) * 16777619;
+
+	return hash;
+}
+
+
+/***********************************************************************
+**
+*/	static void Rehash_Stacks(void)
+/*
+**		Double the size of the hash table and reinsert all stacks.
+**
+***********************************************************************/
+{
+	REBCNT size = SERIES_TAIL(Prof_Hash) * 2;
+	REBCNT *hashes;
+	REBCNT *rec;
+	REBCNT n;
+	REBCNT i;
+
+	Free_Series(Prof_Hash);
+	Prof_Hash = Make_Series(size, sizeof(REBCNT), FALSE);
+	KEEP_SERIES(Prof_Hash, "profile hash");
+	CLEAR_SERIES(Prof_Hash);
+	Prof_Hash->tail = size;
+	hashes = (REBCNT *)(Prof_Hash->data);
+
+	for (i = 0; i < SERIES_TAIL(Prof_Stacks); i += rec[1] + 2) {
+		rec = PROF_REC(i);
+		n = Hash_Stack(rec + 2, rec[1]) & (size - 1);
+		while (hashes[n]) n = (n + 1) & (size - 1);
+		hashes[n] = i + 1;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	void Sample_Stack(void)
+/*
+**		Count the current stack of function frames, from the frame
+**		of PROFILE up. Called from Do_Signals at the sample rate.
+**
+***********************************************************************/
+{
+	REBCNT syms[PROF_DEPTH];
+	REBCNT depth = 0;
+	REBINT dsf;
+	REBCNT mask;
+	REBCNT *hashes;
+	REBCNT *rec;
+	REBCNT n;
+	REBCNT i;
+
+	if (DSF < Prof_Base) return;
+
+	// Innermost frames go last:
+	for (dsf = DSF; dsf >= Prof_Base && depth < PROF_DEPTH; dsf = PRIOR_DSF(dsf)) depth++;
+	for (dsf = DSF, i = depth; i > 0; dsf = PRIOR_DSF(dsf))
+		syms[--i] = VAL_WORD_SYM(DSF_WORD(dsf));
+
+	mask = SERIES_TAIL(Prof_Hash) - 1;
+	hashes = (REBCNT *)(Prof_Hash->data);
+	for (n = Hash_Stack(syms, depth) & mask; NZ(i = hashes[n]); n = (n + 1) & mask) {
+		rec = PROF_REC(i - 1);
+		if (rec[1] == depth && !memcmp(rec + 2, syms, depth * sizeof(REBCNT))) {
+			rec[0]++;
+			return;
+		}
+	}
+
+	// A new stack:
+	i = SERIES_TAIL(Prof_Stacks);
+	EXPAND_SERIES_TAIL(Prof_Stacks, depth + 2);
+	rec = PROF_REC(i);
+	rec[0] = 1;
+	rec[1] = depth;
+	memcpy(rec + 2, syms, depth * sizeof(REBCNT));
+	hashes[n] = i + 1;
+
+	if (++Prof_Entries * 2 > mask) Rehash_Stacks();
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Collapse_Stacks(void)
+/*
+**		Return a string of the stacks, one per line, in the form
+**		read by flame graph tools: outer;inner;innermost count
+**
+***********************************************************************/
+{
+	REBSER *ser = Make_Binary(SERIES_TAIL(Prof_Stacks) * 8);
+	REBCNT *rec;
+	REBCNT i;
+	REBCNT n;
+
+	for (i = 0; i < SERIES_TAIL(Prof_Stacks); i += rec[1] + 2) {
+		rec = PROF_REC(i);
+		for (n = 0; n < rec[1]; n++) {
+			if (n > 0) Append_Byte(ser, ';');
+			Append_UTF8(ser, Get_Sym_Name(rec[n + 2]), -1);
+		}
+		Append_Byte(ser, ' ');
+		Append_Int(ser, rec[0]);
+		Append_Byte(ser, LF);
+	}
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	static int Compare_Self(const void *v1, const void *v2)
+/*
+**		Sort rows of [word self total] by most self samples first.
+**
+***********************************************************************/
+{
+	REBI64 n = VAL_INT64((REBVAL *)v2 + 1) - VAL_INT64((REBVAL *)v1 + 1);
+
+	if (n == 0) n = VAL_INT64((REBVAL *)v2 + 2) - VAL_INT64((REBVAL *)v1 + 2);
+	return (n > 0) ? 1 : (n < 0) ? -1 : 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *Count_Stacks(void)
+/*
+**		Return a block of [word self total] for each function
+**		sampled: the samples that were in it (self), and in it or
+**		in what it called (total). Most self samples first.
+**
+***********************************************************************/
+{
+	REBCNT words = SERIES_TAIL(PG_Word_Table.series);
+	REBCNT *self = Make_Mem(words * 2 * sizeof(REBCNT));
+	REBCNT *total = self + words;
+	REBSER *blk;
+	REBVAL *val;
+	REBCNT *rec;
+	REBCNT i;
+	REBCNT n;
+	REBCNT k;
+
+	for (i = 0; i < SERIES_TAIL(Prof_Stacks); i += rec[1] + 2) {
+		rec = PROF_REC(i);
+		if (rec[1] == 0) continue;
+		self[rec[rec[1] + 1]] += rec[0];
+		// A recursive function counts once per sample:
+		for (n = 0; n < rec[1]; n++) {
+			for (k = 0; k < n && rec[k + 2] != rec[n + 2]; k++);
+			if (k == n) total[rec[n + 2]] += rec[0];
+		}
+	}
+
+	blk = Make_Block(64);
+	for (n = 1; n < words; n++) {
+		if (!total[n]) continue;
+		val = Append_Value(blk);
+		Init_Word(val, n);
+		val = Append_Value(blk);
+		SET_INTEGER(val, self[n]);
+		val = Append_Value(blk);
+		SET_INTEGER(val, total[n]);
+	}
+	Free_Mem(self, words * 2 * sizeof(REBCNT));
+
+	qsort((void *)BLK_HEAD(blk), SERIES_TAIL(blk) / 3, 3 * sizeof(REBVAL), Compare_Self);
+
+	return blk;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Hash_Site(REBCNT word, REBCNT func)
+/*
+***********************************************************************/
+{
+	return (word * 2654435761u) ^ func;
+}
+
+
+/***********************************************************************
+**
+*/	static void Rehash_Sites(REBSER *sites)
+/*
+**		Double the size of the site hash table and reinsert all.
+**
+***********************************************************************/
+{
+	REBCNT size = SERIES_TAIL(Prof_Site_Hash) * 2;
+	REBSER *ser = Make_Series(size, sizeof(REBCNT), FALSE);
+	REBCNT *hashes = (REBCNT *)(ser->data);
+	REBSITE *site;
+	REBCNT n;
+	REBCNT i;
+
+	KEEP_SERIES(ser, "profile site hash");
+	CLEAR_SERIES(ser);
+	ser->tail = size;
+
+	for (i = 0; i < SERIES_TAIL(sites); i++) {
+		site = PROF_SITE(sites, i);
+		n = Hash_Site(site->word, site->func) & (size - 1);
+		while (hashes[n]) n = (n + 1) & (size - 1);
+		hashes[n] = i + 1;
+	}
+
+	Free_Series(Prof_Site_Hash);
+	Prof_Site_Hash = ser;
+}
+
+
+/***********************************************************************
+**
+*/	void Count_Series(REBSER *series)
+/*
+**		Count a new series to the word of the current frame and
+**		the function it was called from. Called from Make_Series
+**		during PROFILE/memory.
+**
+***********************************************************************/
+{
+	REBSER *sites = Prof_Sites;
+	REBCNT word = VAL_WORD_SYM(DSF_WORD(DSF));
+	REBCNT func = 0;
+	REBCNT mask = SERIES_TAIL(Prof_Site_Hash) - 1;
+	REBCNT *hashes = (REBCNT *)(Prof_Site_Hash->data);
+	REBSITE *site;
+	REBINT dsf;
+	REBCNT n;
+	REBCNT i;
+
+	for (dsf = PRIOR_DSF(DSF); dsf > Prof_Base; dsf = PRIOR_DSF(dsf)) {
+		if (IS_FUNCTION(DSF_FUNC(dsf)) || IS_CLOSURE(DSF_FUNC(dsf))) {
+			func = VAL_WORD_SYM(DSF_WORD(dsf));
+			break;
+		}
+	}
+
+	for (n = Hash_Site(word, func) & mask; NZ(i = hashes[n]); n = (n + 1) & mask) {
+		site = PROF_SITE(sites, i - 1);
+		if (site->word == word && site->func == func) break;
+	}
+
+	if (!i) {
+		// A new site (the series made here are not counted):
+		Prof_Sites = 0;
+		i = SERIES_TAIL(sites);
+		EXPAND_SERIES_TAIL(sites, 1);
+		site = PROF_SITE(sites, i);
+		CLEARS(site);
+		site->word = word;
+		site->func = func;
+		hashes[n] = ++i;
+		if (i * 2 > mask) Rehash_Sites(sites);
+		Prof_Sites = sites;
+	}
+
+	site = PROF_SITE(sites, i - 1);
+	site->made++;
+	site->bytes += SERIES_TOTAL(series);
+	if (Prof_Site_Base + i <= SITE_MAX) SET_GEN_SITE(series, Prof_Site_Base + i);
+}
+
+
+/***********************************************************************
+**
+*/	static void Count_Live(REBSER *sites)
+/*
+**		Count the series still alive to their sites (after a
+**		recycle). Their site numbers are cleared, so that a later
+**		profile will not find them.
+**
+***********************************************************************/
+{
+	REBCNT first = Prof_Site_Base + 1;
+	REBCNT last = Prof_Site_Base + SERIES_TAIL(sites);
+	REBSEG *seg;
+	REBSER *series;
+	REBSITE *site;
+	REBCNT n;
+
+	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
+		series = (REBSER *)(seg + 1);
+		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--, series++) {
+			if (SERIES_FREED(series)) continue;
+			if (GEN_SITE(series) < first || GEN_SITE(series) > last) continue;
+			site = PROF_SITE(sites, GEN_SITE(series) - first);
+			site->live++;
+			site->live_bytes += SERIES_TOTAL(series);
+			SET_GEN_SITE(series, 0);
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static int Compare_Site_Bytes(const void *v1, const void *v2)
+/*
+**		Sort rows of [word function made bytes live live-bytes] by
+**		most bytes first.
+**
+***********************************************************************/
+{
+	REBI64 n = VAL_INT64((REBVAL *)v2 + 3) - VAL_INT64((REBVAL *)v1 + 3);
+
+	return (n > 0) ? 1 : (n < 0) ? -1 : 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBSER *List_Sites(REBSER *sites)
+/*
+**		Return a block of [word function made bytes live live-bytes]
+**		for each site: the series made there, and of them, those
+**		still alive at the end. Most bytes made first.
+**
+***********************************************************************/
+{
+	REBSER *blk = Make_Block(SERIES_TAIL(sites) * 6);
+	REBVAL *val;
+	REBSITE *site;
+	REBCNT i;
+
+	for (i = 0; i < SERIES_TAIL(sites); i++) {
+		site = PROF_SITE(sites, i);
+		val = Append_Value(blk);
+		Init_Word(val, site->word);
+		val = Append_Value(blk);
+		if (site->func) Init_Word(val, site->func);
+		else SET_NONE(val);
+		val = Append_Value(blk);
+		SET_INTEGER(val, site->made);
+		val = Append_Value(blk);
+		SET_INTEGER(val, site->bytes);
+		val = Append_Value(blk);
+		SET_INTEGER(val, site->live);
+		val = Append_Value(blk);
+		SET_INTEGER(val, site->live_bytes);
+	}
+
+	qsort((void *)BLK_HEAD(blk), SERIES_TAIL(blk) / 6, 6 * sizeof(REBVAL), Compare_Site_Bytes);
+
+	return blk;
+}
+
+
+/***********************************************************************
+**
+*/	REBNATIVE(profile)
+/*
+**		Evaluate a block, sampling its stack of function calls,
+**		or with /memory, counting the series made by them.
+**
+**		Profiles can be nested; the outer one does not sample
+**		(or count) while the inner one runs.
+**
+***********************************************************************/
+{
+	REBSER *stacks = Prof_Stacks;
+	REBSER *hashes = Prof_Hash;
+	REBCNT entries = Prof_Entries;
+	REBINT base = Prof_Base;
+	REBSER *outer_sites = Prof_Sites;
+	REBSER *site_hash = Prof_Site_Hash;
+	REBCNT site_base = Prof_Site_Base;
+	REBSER *sites = 0;
+	REBINT dose = Eval_Dose;
+	REBINT rate = D_REF(2) ? Int32s(D_ARG(3), 1) : PROF_RATE;
+	REBFLG error;
+
+	Check_Security(SYM_DEBUG, POL_READ, 0);
+
+	// Sites of the outer profile keep their numbers:
+	if (Prof_Sites) Prof_Site_Base += SERIES_TAIL(Prof_Sites);
+	Prof_Sites = 0;
+	Prof_Stacks = 0;
+	Prof_Base = DSF;
+
+	if (D_REF(5)) {
+		sites = Make_Series(SITE_HASH, sizeof(REBSITE), FALSE);
+		KEEP_SERIES(sites, "profile sites");
+		Prof_Site_Hash = Make_Series(SITE_HASH, sizeof(REBCNT), FALSE);
+		KEEP_SERIES(Prof_Site_Hash, "profile site hash");
+		CLEAR_SERIES(Prof_Site_Hash);
+		Prof_Site_Hash->tail = SITE_HASH;
+		Prof_Sites = sites;
+	}
+	else {
+		Prof_Stacks = Make_Series(PROF_HASH * 4, sizeof(REBCNT), FALSE);
+		KEEP_SERIES(Prof_Stacks, "profile stacks");
+		Prof_Hash = Make_Series(PROF_HASH, sizeof(REBCNT), FALSE);
+		KEEP_SERIES(Prof_Hash, "profile hash");
+		CLEAR_SERIES(Prof_Hash);
+		Prof_Hash->tail = PROF_HASH;
+		Prof_Entries = 0;
+
+		// Count down from the sample rate (keeping the eval total):
+		Eval_Cycles += Eval_Dose - Eval_Count;
+		Eval_Dose = Eval_Count = rate;
+	}
+
+	error = Try_Block(VAL_SERIES(D_ARG(1)), VAL_INDEX(D_ARG(1)));
+
+	if (sites) {
+		Prof_Sites = 0;
+		if (!error && !THROWN(DS_NEXT)) {
+			Recycle();
+			Count_Live(sites);
+			Set_Block(D_RET, List_Sites(sites));
+		}
+		else Count_Live(sites);
+		Free_Series(sites);
+		Free_Series(Prof_Site_Hash);
+	}
+	else {
+		Eval_Cycles += Eval_Dose - Eval_Count;
+		Eval_Dose = Eval_Count = dose;
+
+		if (!error && !THROWN(DS_NEXT)) {
+			if (D_REF(4)) Set_String(D_RET, Collapse_Stacks());
+			else Set_Block(D_RET, Count_Stacks());
+		}
+
+		Free_Series(Prof_Stacks);
+		Free_Series(Prof_Hash);
+	}
+
+	Prof_Stacks = stacks;
+	Prof_Hash = hashes;
+	Prof_Entries = entries;
+	Prof_Base = base;
+	Prof_Sites = outer_sites;
+	Prof_Site_Hash = site_hash;
+	Prof_Site_Base = site_base;
+
+	if (error) Throw_Break(DS_NEXT);
+	if (THROWN(DS_NEXT)) return R_TOS1;
+
+	return R_RET;
+}
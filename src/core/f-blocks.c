@@ -135,8 +135,9 @@
 				if ((types & CP_DEEP) != 0)
 					Copy_Deep_Values(VAL_SERIES(val), 0, VAL_TAIL(val), types);
 			}
-		} else if (types & TYPESET(VAL_TYPE(val)) & TS_FUNCLOS)
-			Clone_Function(val, val);
+		} else if ((types & TYPESET(VAL_TYPE(val)) & TS_FUNCLOS)
+			&& !(IS_METHOD(val) && VAL_METHOD_SELF(val) == block))
+			Clone_Function(val, val); // (a method of the object is shared, see Make_Method)
 	}
 }
 
@@ -280,6 +281,7 @@ x*/	REBSER *Copy_Block_Deep(REBSER *block, REBCNT index, REBINT len, REBCNT mode
 		type = VAL_TYPE(into);
 		series = VAL_SERIES(into);
 		if (IS_PROTECT_SERIES(series)) Trap0(RE_PROTECTED);
+		REMEMBER_SERIES(series);
 		len = Insert_Series(series, VAL_INDEX(into), (REBYTE*)blk, len);
 	} else {
 		series = Make_Series(len + 1, sizeof(REBVAL), FALSE);
@@ -311,6 +313,7 @@ x*/	REBSER *Copy_Block_Deep(REBSER *block, REBCNT index, REBINT len, REBCNT mode
 	REBVAL *value;
 
 	EXPAND_SERIES_TAIL(block, 1);
+	REMEMBER_SERIES(block);
 	value = BLK_TAIL(block);
 	SET_END(value);
 	value--;
@@ -344,6 +347,7 @@ x*/	REBSER *Copy_Block_Deep(REBSER *block, REBCNT index, REBINT len, REBCNT mode
 	REBVAL *value;
 
 	EXPAND_SERIES_TAIL(block, 1);
+	REMEMBER_SERIES(block);
 	value = BLK_TAIL(block);
 	SET_END(value);
 	value--;
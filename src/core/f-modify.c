@@ -54,6 +54,8 @@
 
 	if (dups < 0) return (action == A_APPEND) ? 0 : dst_idx;
 	if (action == A_APPEND || dst_idx > tail) dst_idx = tail;
+	UNCOMPILE_BLOCK(dst_ser);
+	REMEMBER_SERIES(dst_ser);
 
 	// Check /PART, compute LEN:
 	if (!GET_FLAG(flags, AN_ONLY) && ANY_BLOCK(src_val)) {
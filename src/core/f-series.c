@@ -114,6 +114,7 @@
 	case A_REMOVE:
 		// /PART length
 		TRAP_PROTECT(VAL_SERIES(value));
+		if (ANY_BLOCK(value)) UNCOMPILE_BLOCK(VAL_SERIES(value));
 		len = DS_REF(2) ? Partial(value, 0, DS_ARG(3), 0) : 1;
 		index = (REBINT)VAL_INDEX(value);
 		if (index < tail && len != 0)
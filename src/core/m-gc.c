@@ -40,9 +40,29 @@
 **				Safe Series: saves the last N allocations
 **
 **				Mark is recursive until we reach the terminals, or
-**				until we hit values already marked.
+**				until we hit values already marked. Deep blocks go
+**				on a mark stack instead (see Mark_Gray).
 **
 **		SWEEP - Free all collectible values that were not marked.
+**				With RECYCLE/parallel, threads scan the segments, and
+**				the dead are freed after (see Sweep_Parallel).
+**
+**	  Minor recycle (generational, see Recycle_Auto):
+**
+**		Series that survive a recycle become old. A minor recycle
+**		marks and frees only the new series. Old blocks are not
+**		scanned, except for the roots, object frames, and blocks
+**		written since the last recycle. So code that stores a value
+**		into a block that may be old must use REMEMBER_SERIES.
+**		Old garbage is freed by the next full recycle.
+**
+**	  Incremental recycle (see Collect_Slice):
+**
+**		Marking and sweeping are done in slices, between which the
+**		code runs. Blocks are white (not marked), gray (marked, to
+**		be scanned), or black (scanned). The same write barrier
+**		lets the marking end with no black block referring to a
+**		white series. Series made while sweeping are kept.
 **
 **	  GC protection methods:
 **
@@ -85,6 +105,81 @@
 extern REBOL_HOST_LIB *Host_Lib;
 #endif
 
+#define GC_MINOR_MAX 8	// minor recycles between full ones
+#define GC_PACE 16		// incremental slices per ballast
+#define GC_SCAN_PART 4096	// values of a large block scanned at a time
+#define GC_MARK_DEPTH 128	// blocks deeper are put on the mark stack
+#define GC_PART_SEGS 4		// fewest segments swept per thread
+
+#ifdef __GNUC__
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p)
+#endif
+
+#define APPEND_SERIES_PTR(s, p) { \
+	if (SERIES_FULL(s)) Extend_Series(s, 64); \
+	((REBSER **)(s)->data)[(s)->tail++] = (p); }
+
+// The mark stack (GC_Gray) holds blocks to scan from an index:
+typedef struct Reb_Gray {
+	REBSER *series;
+	REBCNT index;	// zero: not yet scanned
+} REBGRY;
+
+// A part of a pool swept by a thread (see Sweep_Parallel):
+typedef struct Reb_Sweep {
+	REBCNT pool;
+	REBSEG **segs;
+	REBCNT count;	// number of segments
+	REBCNT *dead;	// a bit for each node to be freed
+} REBSWP;
+
+#define DEAD_WORDS(units) (((units) + 31) / 32)
+
+#define PUSH_GRAY(s, i) { \
+	if (SERIES_FULL(GC_Gray)) Extend_Series(GC_Gray, 64); \
+	((REBGRY *)GC_Gray->data)[GC_Gray->tail].series = (s); \
+	((REBGRY *)GC_Gray->data)[GC_Gray->tail++].index = (i); }
+
+// WARNING: These terminate existing open blocks. This could
+// be a problem if code is building a new value at the tail,
+// but has not yet updated the TAIL marker.
+#define TERMINATE_BUFFERS { \
+	DS_TERMINATE; /* Update data stack tail */ \
+	VAL_BLK_TERM(TASK_BUF_EMIT); \
+	VAL_BLK_TERM(TASK_BUF_WORDS); }
+//!!!	SET_END(BLK_TAIL(Save_Value_List));
+
+// A heap snapshot, recorded by the marking of a recycle (see Snap_Heap):
+typedef struct Reb_Snap {
+	REBYTE *nodes;		// node records (SNAP_NODE bytes each)
+	REBYTE *edges;		// edge records (SNAP_EDGE bytes each)
+	REBCNT count;		// nodes (ids are from 1)
+	REBCNT links;		// edges
+	REBCNT room;		// nodes and edges there is room for
+	REBCNT edge_room;
+	REBSER **keys;		// hash table of the series seen
+	REBCNT *ids;		// and their ids
+	REBCNT size;		// of the hash table (power of 2)
+	REBCNT from;		// id of the block being scanned (0: a root)
+	REBCNT last;		// id of the last edge made from it
+	REBFLG full;		// out of memory: the snapshot is not complete
+} REBSNP;
+
+#define SNAP_NODE 14	// parent, bytes, tail (32 bits), type, wide (8 bits)
+#define SNAP_EDGE 8		// from, to (32 bits)
+
+static REBSNP *GC_Snap;
+
+// Mark a series referred to (also for a snapshot). The type is that
+// of the value that refers to it (zero if internal):
+#define MARK_REF(s, t)    {if (snap) Snap_Ref(s, t); MARK_SERIES(s);}
+#define CHECK_REF(s, d, t) {if (snap) Snap_Ref(s, t); CHECK_MARK(s, d);}
+
+// A word list holds no values to mark, but may hold an arg plan:
+#define MARK_WORDS(w) {MARK_REF(w, 0); if ((w)->series) MARK_REF((w)->series, 0);}
+
 //-- For Serious Debugging:
 #ifdef WATCH_GC_VALUE
 REBSER *Watcher = 0;
@@ -112,12 +207,137 @@ REBVAL *N_watch(REBFRM *frame, REBVAL **inter_block)
 static void Mark_Series(REBSER *series, REBCNT depth);
 
 
+/***********************************************************************
+**
+*/	static void Put_Snap_Int(REBYTE *bp, REBCNT n)
+/*
+**		Store 32 bits, least significant byte first.
+**
+***********************************************************************/
+{
+	bp[0] = (REBYTE)n;
+	bp[1] = (REBYTE)(n >> 8);
+	bp[2] = (REBYTE)(n >> 16);
+	bp[3] = (REBYTE)(n >> 24);
+}
+
+
+/***********************************************************************
+**
+*/	static REBFLG Grow_Snap(REBYTE **mem, REBCNT *room, REBCNT wide)
+/*
+**		Double the room of a snapshot buffer. Returns FALSE if
+**		there is not enough memory (the snapshot is not complete).
+**
+***********************************************************************/
+{
+	REBYTE *bp = Resize_Mem(*mem, *room * wide, *room * wide * 2);
+
+	if (!bp) return FALSE;
+	*mem = bp;
+	*room *= 2;
+	return TRUE;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Snap_Id(REBSER *series, REBCNT type)
+/*
+**		Return the id of a series in the snapshot. If it was not
+**		seen yet, add it, retained by the block being scanned.
+**
+***********************************************************************/
+{
+	REBSNP *snap = GC_Snap;
+	REBCNT mask = snap->size - 1;
+	REBCNT n = ((REBUPT)series >> 5) & mask;
+	REBYTE *bp;
+	REBSER **keys;
+	REBCNT *ids;
+	REBCNT i;
+
+	for (; snap->keys[n]; n = (n + 1) & mask)
+		if (snap->keys[n] == series) return snap->ids[n];
+
+	if (snap->full) return 0;
+	if (snap->count == snap->room && !Grow_Snap(&snap->nodes, &snap->room, SNAP_NODE)) {
+		snap->full = TRUE;
+		return 0;
+	}
+
+	// Keep the hash table at most half full:
+	if ((snap->count + 1) * 2 > snap->size) {
+		keys = Make_Mem(snap->size * 2 * sizeof(REBSER *));
+		ids = Make_Mem(snap->size * 2 * sizeof(REBCNT));
+		if (!keys || !ids) {
+			if (keys) Free_Mem(keys, snap->size * 2 * sizeof(REBSER *));
+			if (ids) Free_Mem(ids, snap->size * 2 * sizeof(REBCNT));
+			snap->full = TRUE;
+			return 0;
+		}
+		mask = snap->size * 2 - 1;
+		for (i = 0; i < snap->size; i++) {
+			if (!snap->keys[i]) continue;
+			for (n = ((REBUPT)snap->keys[i] >> 5) & mask; keys[n]; n = (n + 1) & mask);
+			keys[n] = snap->keys[i];
+			ids[n] = snap->ids[i];
+		}
+		Free_Mem(snap->keys, snap->size * sizeof(REBSER *));
+		Free_Mem(snap->ids, snap->size * sizeof(REBCNT));
+		snap->keys = keys;
+		snap->ids = ids;
+		snap->size *= 2;
+		for (n = ((REBUPT)series >> 5) & mask; keys[n]; n = (n + 1) & mask);
+	}
+
+	bp = snap->nodes + snap->count++ * SNAP_NODE;
+	Put_Snap_Int(bp, snap->from);
+	Put_Snap_Int(bp + 4, SERIES_TOTAL(series));
+	Put_Snap_Int(bp + 8, SERIES_TAIL(series));
+	bp[12] = (REBYTE)type;
+	bp[13] = (REBYTE)SERIES_WIDE(series);
+
+	snap->keys[n] = series;
+	snap->ids[n] = snap->count;
+	return snap->count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Snap_Ref(REBSER *series, REBCNT type)
+/*
+**		Add to the snapshot a reference from the block being
+**		scanned (or a root) to a series. (Repeats are dropped.)
+**
+***********************************************************************/
+{
+	REBSNP *snap = GC_Snap;
+	REBCNT to;
+	REBYTE *bp;
+
+	if (SERIES_FREED(series) || !NZ(to = Snap_Id(series, type))) return;
+	if (to == snap->last) return;
+	snap->last = to;
+
+	if (snap->links == snap->edge_room && !Grow_Snap(&snap->edges, &snap->edge_room, SNAP_EDGE)) {
+		snap->full = TRUE;
+		return;
+	}
+	bp = snap->edges + snap->links++ * SNAP_EDGE;
+	Put_Snap_Int(bp, snap->from);
+	Put_Snap_Int(bp + 4, to);
+}
+
+
 /***********************************************************************
 **
 */	static void Mark_Gob(REBGOB *gob, REBCNT depth)
 /*
 ***********************************************************************/
 {
+	REBSNP *snap = GC_Snap;
 	REBGOB **pane;
 	REBCNT i;
 
@@ -126,7 +346,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 	MARK_GOB(gob);
 
 	if (GOB_PANE(gob)) {
-		MARK_SERIES(GOB_PANE(gob));
+		MARK_REF(GOB_PANE(gob), REB_GOB);
 		pane = GOB_HEAD(gob);
 		for (i = 0; i < GOB_TAIL(gob); i++, pane++) {
 			Mark_Gob(*pane, depth);
@@ -137,14 +357,14 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 
 	if (GOB_CONTENT(gob)) {
 		if (GOB_TYPE(gob) >= GOBT_IMAGE && GOB_TYPE(gob) <= GOBT_STRING) {
-			MARK_SERIES(GOB_CONTENT(gob));
+			MARK_REF(GOB_CONTENT(gob), REB_GOB);
 		} else if (GOB_TYPE(gob) >= GOBT_DRAW && GOB_TYPE(gob) <= GOBT_EFFECT) {
-			CHECK_MARK(GOB_CONTENT(gob), depth);
+			CHECK_REF(GOB_CONTENT(gob), depth, REB_GOB);
 		}
 	}
 
 	if (GOB_DATA(gob) && GOB_DTYPE(gob) && GOB_DTYPE(gob) != GOBD_INTEGER) {
-		CHECK_MARK(GOB_DATA(gob), depth);
+		CHECK_REF(GOB_DATA(gob), depth, REB_GOB);
 	}
 }
 
@@ -155,6 +375,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 /*
 ***********************************************************************/
 {
+	REBSNP *snap = GC_Snap;
 	REBREQ *req;
 	
 	if (
@@ -164,7 +385,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 	) {
 		// The ->ser field of the REBEVT is void*, so we must cast
 		// Comment says it is a "port or object"
-		CHECK_MARK((REBSER*)VAL_EVENT_SER(value), depth);
+		CHECK_REF((REBSER*)VAL_EVENT_SER(value), depth, REB_EVENT);
 	} 
 
 	if (IS_EVENT_MODEL(value, EVM_DEVICE)) {
@@ -177,7 +398,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 		while(req) {
 			// The ->port field of the REBREQ is void*, so we must cast
 			// Comment says it is "link back to REBOL port object"
-			if (req->port) CHECK_MARK((REBSER*)req->port, depth);
+			if (req->port) CHECK_REF((REBSER*)req->port, depth, REB_EVENT);
 			req = req->next;
 		}
 	}
@@ -191,6 +412,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 **
 ***********************************************************************/
 {
+	REBSNP *snap = GC_Snap;
 	int d;
 	REBDEV *dev;
 	REBREQ *req;
@@ -200,40 +422,62 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 		dev = devices[d];
 		if (dev)
 			for (req = dev->pending; req; req = req->next)
-				if (req->port) CHECK_MARK((REBSER*)req->port, depth);
+				if (req->port) CHECK_REF((REBSER*)req->port, depth, REB_PORT);
 	}
 }
 
 /***********************************************************************
 **
-*/	static void Mark_Series(REBSER *series, REBCNT depth)
+*/	static void Mark_Code(REBSER *block, REBCNT depth)
 /*
-**		Mark all series reachable from the block.
+**		Mark the code cells of a block (see Compile_Block), and
+**		the functions they refer to (so their args series pointers
+**		cannot be reused). Stale cells are dropped instead.
 **
 ***********************************************************************/
 {
-	REBCNT len;
-	REBSER *ser;
-	REBVAL *val;
-
-	ASSERT(series != 0, RP_NULL_MARK_SERIES);
+	REBSNP *snap = GC_Snap;
+	REBSER *code = block->series;
+	REBCOD *cell;
+	REBCNT n;
 
-	if (SERIES_FREED(series)) return; // series data freed already
+	if (SERIES_TAIL(code) != SERIES_TAIL(block)) {
+		block->series = 0;
+		return;
+	}
 
-	MARK_SERIES(series);
+	MARK_REF(code, 0);
 
-	// If not a block, go no further
-	if (SERIES_WIDE(series) != sizeof(REBVAL)) return;
-
-	ASSERT2(RP_SERIES_OVERFLOW, SERIES_TAIL(series) < SERIES_REST(series));
+	for (n = 0, cell = CODE_SKIP(code, 0); n < SERIES_TAIL(code); n++, cell++)
+		if (cell->args) CHECK_REF(cell->args, depth, 0);
+}
 
-	//Moved to end: ASSERT1(IS_END(BLK_TAIL(series)), RP_MISSING_END);
 
-	//if (depth == 1 && series->label) Print("Marking %s", series->label);
+/***********************************************************************
+**
+*/	static void Mark_Values(REBSER *series, REBCNT len, REBCNT depth)
+/*
+**		Mark the series that the values of a block refer to, from
+**		the index (len) to the tail.
+**
+**		A large block is scanned in parts: the rest of it goes on
+**		the mark stack below the blocks of this part, so they are
+**		scanned while still in the cache (and a slice stays short).
+**
+***********************************************************************/
+{
+	REBCNT tail = series->tail;
+	REBSNP *snap = GC_Snap;
+	REBSER *ser;
+	REBVAL *val;
 
-	depth++;
+	if (tail > len + GC_SCAN_PART) {
+		tail = len + GC_SCAN_PART;
+		series->gen |= GEN_GRAY; // (not done)
+		PUSH_GRAY(series, tail);
+	}
 
-	for (len = 0; len < series->tail; len++) {
+	for (; len < tail; len++) {
 		val = BLK_SKIP(series, len);
 
 		switch (VAL_TYPE(val)) {
@@ -251,7 +495,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 
 		case REB_DATATYPE:
 			if (VAL_TYPE_SPEC(val)) {	// allow it to be zero
-				CHECK_MARK(VAL_TYPE_SPEC(val), depth); // check typespec.r file
+				CHECK_REF(VAL_TYPE_SPEC(val), depth, VAL_TYPE(val)); // check typespec.r file
 			}
 			break;
 
@@ -261,7 +505,7 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 			// it contains temporary values on the stack that could be
 			// above the current DSP (where the THROW was done).
 			if (VAL_ERR_NUM(val) > RE_THROW_MAX) {
-				if (VAL_ERR_OBJECT(val)) CHECK_MARK(VAL_ERR_OBJECT(val), depth);
+				if (VAL_ERR_OBJECT(val)) CHECK_REF(VAL_ERR_OBJECT(val), depth, VAL_TYPE(val));
 			}
 			// else Crash(RP_THROW_IN_GC); // !!!! in question - is it true?
 			break;
@@ -272,8 +516,8 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 		case REB_FRAME:
 			// Mark special word list. Contains no pointers because
 			// these are special word bindings (to typesets if used).
-			if (VAL_FRM_WORDS(val)) MARK_SERIES(VAL_FRM_WORDS(val));
-			if (VAL_FRM_SPEC(val)) {CHECK_MARK(VAL_FRM_SPEC(val), depth);}
+			if (VAL_FRM_WORDS(val)) MARK_WORDS(VAL_FRM_WORDS(val));
+			if (VAL_FRM_SPEC(val)) {CHECK_REF(VAL_FRM_SPEC(val), depth, VAL_TYPE(val));}
 			break;
 
 		case REB_PORT:
@@ -282,10 +526,11 @@ static void Mark_Series(REBSER *series, REBCNT depth);
 			goto mark_obj;
 
 		case REB_MODULE:
-			if (VAL_MOD_BODY(val)) CHECK_MARK(VAL_MOD_BODY(val), depth);
+			if (VAL_MOD_BODY(val)) CHECK_REF(VAL_MOD_BODY(val), depth, VAL_TYPE(val));
 		case REB_OBJECT:
 			// Object is just a block with special first value (context):
 mark_obj:
+			if (snap) Snap_Ref(VAL_OBJ_FRAME(val), VAL_TYPE(val));
 			if (!IS_MARK_SERIES(VAL_OBJ_FRAME(val))) {
 				Mark_Series(VAL_OBJ_FRAME(val), depth);
 				if (SERIES_TAIL(VAL_OBJ_FRAME(val)) >= 1)
@@ -297,12 +542,14 @@ mark_obj:
 		case REB_COMMAND:
 		case REB_CLOSURE:
 		case REB_REBCODE:
-			CHECK_MARK(VAL_FUNC_BODY(val), depth);
+			CHECK_REF(VAL_FUNC_BODY(val), depth, VAL_TYPE(val));
 		case REB_NATIVE:
 		case REB_ACTION:
 		case REB_OP:
-			CHECK_MARK(VAL_FUNC_SPEC(val), depth);
-			MARK_SERIES(VAL_FUNC_ARGS(val));
+			CHECK_REF(VAL_FUNC_SPEC(val), depth, VAL_TYPE(val));
+			MARK_WORDS(VAL_FUNC_ARGS(val));
+			// A method keeps its spec in its args (see Make_Method):
+			if (IS_METHOD(val)) CHECK_REF(ARGS_SPEC(VAL_FUNC_ARGS(val)), depth, VAL_TYPE(val));
 			// There is a problem for user define function operators !!!
 			// Their bodies are not GC'd!
 			break;
@@ -318,7 +565,7 @@ mark_obj:
 			// Mark its context, if it has one:
 			if (VAL_WORD_INDEX(val) > 0 && NZ(ser = VAL_WORD_FRAME(val))) {
 				//if (SERIES_TAIL(ser) > 100) Dump_Word_Value(val);
-				CHECK_MARK(ser, depth);
+				CHECK_REF(ser, depth, VAL_TYPE(val));
 			}
 			// Possible bug above!!! We cannot mark relative words (negative
 			// index) because the frame pointer does not point to a context,
@@ -350,16 +597,16 @@ mark_obj:
 			ser = VAL_SERIES(val);
 			if (SERIES_WIDE(ser) > sizeof(REBUNI))
 				Crash(RP_BAD_WIDTH, sizeof(REBUNI), SERIES_WIDE(ser), VAL_TYPE(val));
-			MARK_SERIES(ser);
+			MARK_REF(ser, VAL_TYPE(val));
 			break;
 
 		case REB_IMAGE:
 			//MARK_SERIES(VAL_SERIES_SIDE(val)); //????
-			MARK_SERIES(VAL_SERIES(val));
+			MARK_REF(VAL_SERIES(val), VAL_TYPE(val));
 			break;
 
 		case REB_VECTOR:
-			MARK_SERIES(VAL_SERIES(val));
+			MARK_REF(VAL_SERIES(val), VAL_TYPE(val));
 			break;
 
 		case REB_BLOCK:
@@ -371,7 +618,7 @@ mark_obj:
 			ser = VAL_SERIES(val);
 			ASSERT(ser != 0, RP_NULL_SERIES);
 			if (IS_BARE_SERIES(ser)) {
-				MARK_SERIES(ser);
+				MARK_REF(ser, VAL_TYPE(val));
 				break;
 			}
 #if (ALEVEL>0)
@@ -380,14 +627,14 @@ mark_obj:
 #endif
 			if (SERIES_WIDE(ser) != sizeof(REBVAL) && SERIES_WIDE(ser) != 4 && SERIES_WIDE(ser) != 0)
 				Crash(RP_BAD_WIDTH, 16, SERIES_WIDE(ser), VAL_TYPE(val));
-			CHECK_MARK(ser, depth);
+			CHECK_REF(ser, depth, VAL_TYPE(val));
 			break;
 
 		case REB_MAP:
 			ser = VAL_SERIES(val);
-			CHECK_MARK(ser, depth);
+			CHECK_REF(ser, depth, VAL_TYPE(val));
 			if (ser->series) {
-				MARK_SERIES(ser->series);
+				MARK_REF(ser->series, VAL_TYPE(val));
 			}
 			break;
 
@@ -404,15 +651,15 @@ mark_obj:
 #endif
 
 		case REB_LIBRARY:
-			MARK_SERIES(VAL_LIBRARY_NAME(val));
+			MARK_REF(VAL_LIBRARY_NAME(val), VAL_TYPE(val));
 //!!!			if (Current_Closing_Library && VAL_LIBRARY_ID(val) == Current_Closing_Library)
 				VAL_LIBRARY_ID(val) = 0; // Invalidate the library
 			break;
 
 		case REB_STRUCT:
-			CHECK_MARK(VAL_STRUCT_SPEC(val), depth);  // is a block
-			CHECK_MARK(VAL_STRUCT_VALS(val), depth);  // "    "
-			MARK_SERIES(VAL_STRUCT_DATA(val));
+			CHECK_REF(VAL_STRUCT_SPEC(val), depth, VAL_TYPE(val));  // is a block
+			CHECK_REF(VAL_STRUCT_VALS(val), depth, VAL_TYPE(val));  // "    "
+			MARK_REF(VAL_STRUCT_DATA(val), VAL_TYPE(val));
 			break;
 
 		case REB_GOB:
@@ -429,12 +676,250 @@ mark_obj:
 	}
 
 #if (ALEVEL>0)
-	if (!IS_END(BLK_SKIP(series, len)) && series != DS_Series)
+	if (len == series->tail && !IS_END(BLK_SKIP(series, len)) && series != DS_Series)
 		Crash(RP_MISSING_END);
 #endif
 }
 
 
+/***********************************************************************
+**
+*/	static void Mark_Series(REBSER *series, REBCNT depth)
+/*
+**		Mark all series reachable from the block. Deep blocks are
+**		put on the mark stack (GC_Gray) for Mark_Gray.
+**
+***********************************************************************/
+{
+	REBSNP *snap = GC_Snap;
+	REBCNT from = 0;
+
+	ASSERT(series != 0, RP_NULL_MARK_SERIES);
+
+	if (SERIES_FREED(series)) return; // series data freed already
+
+	if (GC_Snap) Snap_Id(series, 0); // (if a root)
+
+	MARK_SERIES(series);
+
+	// If not a block, go no further
+	if (SERIES_WIDE(series) != sizeof(REBVAL)) return;
+
+	// A minor recycle scans old blocks only as roots:
+	if (depth > 0 && GC_Minor && IS_OLD_SERIES(series)) return;
+
+	// Deep blocks are scanned from the mark stack (see Mark_Gray),
+	// not by recursion, so they cannot overflow the C stack. So are
+	// all blocks of an incremental recycle, to stop at any point:
+	if (depth >= GC_MARK_DEPTH || (depth > 0 && GC_Phase)) {
+		series->gen |= GEN_GRAY;
+		PREFETCH(series->data);
+		PUSH_GRAY(series, 0);
+		return;
+	}
+	series->gen &= ~GEN_GRAY;
+
+	// For an incremental recycle, it is black now. Scan it again at
+	// the end if it changes, or if it is new (it may be filled
+	// without REMEMBER_SERIES):
+	if (GC_Phase == GC_MARKING) {
+		if (!IS_OLD_SERIES(series)) Remember_Series(series);
+		else series->gen &= ~GEN_DIRTY;
+		series->gen |= GEN_OLD;
+	}
+
+	if (!(GC_Minor && IS_OLD_SERIES(series)) && IS_FRAME(BLK_HEAD(series))) {
+		series->gen |= GEN_FRAME;
+		if (GC_Generational || GC_Phase) APPEND_SERIES_PTR(GC_Frames, series);
+	}
+
+	// The references found now are from this block:
+	if (GC_Snap) {
+		from = GC_Snap->from;
+		GC_Snap->from = Snap_Id(series, 0);
+		GC_Snap->last = 0;
+	}
+
+	// Side series: code cells, path cache, arg plan, or map hashes:
+	if (IS_CODE_SERIES(series->series)) Mark_Code(series, depth);
+	else if (series->series) MARK_REF(series->series, 0);
+
+	ASSERT2(RP_SERIES_OVERFLOW, SERIES_TAIL(series) < SERIES_REST(series));
+
+	//Moved to end: ASSERT1(IS_END(BLK_TAIL(series)), RP_MISSING_END);
+
+	//if (depth == 1 && series->label) Print("Marking %s", series->label);
+
+	Mark_Values(series, 0, depth + 1);
+
+	if (GC_Snap) {
+		GC_Snap->from = from;
+		GC_Snap->last = 0;
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Sweep_Segment(REBSEG *seg)
+/*
+**		Free the series of a segment that have not been marked.
+**
+**		Series made during an incremental sweep are kept, as they
+**		may not be marked. (A few made in segments already swept
+**		keep the flag, and stay until the next recycle.)
+**
+***********************************************************************/
+{
+	REBSER	*series;
+	REBCNT  n;
+	REBCNT	count = 0;
+
+	series = (REBSER *) (seg + 1);
+	for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--) {
+		SKIP_WALL(series);
+		MUNG_CHECK(SERIES_POOL, series, sizeof(*series));
+		if (!SERIES_FREED(series)) {
+			if (IS_FREEABLE(series) && !(GC_Minor && IS_OLD_SERIES(series)) && !(series->gen & GEN_SWEEP)) {
+				Free_Series(series);
+				count++;
+			} else {
+				UNMARK_SERIES(series);
+				series->gen = (series->gen & ~(GEN_DIRTY|GEN_SWEEP)) | GEN_OLD;
+			}
+		}
+		series++;
+		SKIP_WALL(series);
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Sweep_Part(void *part)
+/*
+**		Unmark the nodes of the segments that are kept, and flag
+**		the others as dead. Runs on a thread of its own, so it
+**		changes only the nodes (and dead bits) of its segments.
+**
+***********************************************************************/
+{
+	REBSWP	*sweep = (REBSWP *)part;
+	REBCNT	units = Mem_Pools[sweep->pool].units;
+	REBCNT	*dead = sweep->dead;
+	REBSER	*series;
+	REBGOB	*gob;
+	REBCNT	n;
+	REBCNT	i;
+
+	for (i = 0; i < sweep->count; i++, dead += DEAD_WORDS(units)) {
+		if (sweep->pool == GOB_POOL) {
+			gob = (REBGOB *)(sweep->segs[i] + 1);
+			for (n = 0; n < units; n++, gob++) {
+				if (!IS_GOB_USED(gob)) continue;
+				if (IS_GOB_MARK(gob)) UNMARK_GOB(gob);
+				else dead[n / 32] |= 1 << (n % 32);
+			}
+			continue;
+		}
+		series = (REBSER *)(sweep->segs[i] + 1);
+		for (n = 0; n < units; n++, series++) {
+			if (SERIES_FREED(series)) continue;
+			if (IS_FREEABLE(series) && !(GC_Minor && IS_OLD_SERIES(series)) && !(series->gen & GEN_SWEEP))
+				dead[n / 32] |= 1 << (n % 32);
+			else {
+				UNMARK_SERIES(series);
+				series->gen = (series->gen & ~(GEN_DIRTY|GEN_SWEEP)) | GEN_OLD;
+			}
+		}
+	}
+}
+
+
+/***********************************************************************
+**
+*/	static REBINT Sweep_Parallel(REBCNT pool)
+/*
+**		Sweep a pool with GC_Workers threads, each taking a part
+**		of its segments (see Sweep_Part). The dead nodes are then
+**		freed here, as the pools are not thread safe.
+**
+**		Returns the number freed, or -1 if the pool is too small
+**		to be worth it, or memory is short (the caller sweeps it
+**		then). Not used with MUNGWALL, as the nodes are not a plain
+**		array then (see NODE_SPAN).
+**
+***********************************************************************/
+{
+	REBCNT	units = Mem_Pools[pool].units;
+	REBCNT	segs = Mem_Pools[pool].has / units;
+	REBCNT	parts = MIN(GC_Workers, segs / GC_PART_SEGS);
+	REBCNT	words = segs * DEAD_WORDS(units);
+	REBCNT	list_size = segs * sizeof(REBSEG *);
+	REBSEG	**seg_list;
+	REBSWP	*sweep;
+	REBCNT	*dead;
+	REBSEG	*seg;
+	void	**args;
+	REBCNT	bits;
+	REBCNT	n;
+	REBCNT	i;
+	REBCNT	k;
+	REBINT	count = 0;
+
+#ifdef MUNGWALL
+	return -1;
+#endif
+	if (parts < 2) return -1;
+
+	seg_list = Make_Mem(list_size);
+	dead = Make_Mem(words * sizeof(REBCNT)); // (cleared)
+	sweep = Make_Mem(parts * sizeof(REBSWP));
+	args = Make_Mem(parts * sizeof(void *));
+	if (!seg_list || !dead || !sweep || !args) {
+		count = -1;
+		goto done;
+	}
+
+	for (n = 0, seg = Mem_Pools[pool].segs; seg && n < segs; seg = seg->next)
+		seg_list[n++] = seg;
+	segs = n;
+
+	for (n = i = 0; n < parts; n++) {
+		sweep[n].pool = pool;
+		sweep[n].segs = seg_list + i;
+		sweep[n].count = (segs - i) / (parts - n);
+		sweep[n].dead = dead + i * DEAD_WORDS(units);
+		args[n] = &sweep[n];
+		i += sweep[n].count;
+	}
+
+	OS_RUN_THREADS(Sweep_Part, args, parts);
+
+	for (i = 0; i < segs; i++) {
+		for (n = 0; n < DEAD_WORDS(units); n++) {
+			bits = dead[i * DEAD_WORDS(units) + n];
+			for (k = n * 32; bits; bits >>= 1, k++) {
+				if (!(bits & 1)) continue;
+				if (pool == GOB_POOL) Free_Gob((REBGOB *)(seg_list[i] + 1) + k);
+				else Free_Series((REBSER *)(seg_list[i] + 1) + k);
+				count++;
+			}
+		}
+	}
+
+done:
+	if (seg_list) Free_Mem(seg_list, list_size);
+	if (dead) Free_Mem(dead, words * sizeof(REBCNT));
+	if (sweep) Free_Mem(sweep, parts * sizeof(REBSWP));
+	if (args) Free_Mem(args, parts * sizeof(void *));
+
+	return count;
+}
+
+
 /***********************************************************************
 **
 */	static REBCNT Sweep_Series(void)
@@ -445,30 +930,74 @@ mark_obj:
 **		SERIES_POOL. Free series that have not been marked.
 **
 ***********************************************************************/
+{
+	REBSEG	*seg;
+	REBINT	count;
+
+	if (GC_Workers > 1 && (count = Sweep_Parallel(SERIES_POOL)) >= 0) return count;
+
+	for (count = 0, seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next)
+		count += Sweep_Segment(seg);
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	static void Mark_Old_Series(void)
+/*
+**		Scan the old blocks that may refer to new series, for a
+**		minor recycle: the object frames, and blocks written since
+**		the last recycle. Also the buffers of the root and task
+**		series, and all gobs (which are only freed by a full one).
+**
+**		An incremental recycle uses it to end the marking, as the
+**		black blocks are old: it scans them again, and the gobs
+**		it has marked (their panes have no write barrier).
+**
+***********************************************************************/
 {
 	REBSEG	*seg;
 	REBSER	*series;
+	REBGOB	*gob;
+	REBVAL	*val;
 	REBCNT  n;
-	REBCNT	count = 0;
+	REBCNT  tail;
+
+	// Entries can be stale (freed by other means), so check them.
+	// Frames marked here are added to the list (they are new, or
+	// black ones scanned again):
+	for (n = 0, tail = SERIES_TAIL(GC_Frames); n < tail; n++) {
+		series = ((REBSER **)GC_Frames->data)[n];
+		if (!SERIES_FREED(series) && (series->gen & (GEN_OLD|GEN_FRAME)) == (GEN_OLD|GEN_FRAME))
+			Mark_Series(series, 0);
+	}
 
-	for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
-		series = (REBSER *) (seg + 1);
-		for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--) {
-			SKIP_WALL(series);
-			MUNG_CHECK(SERIES_POOL, series, sizeof(*series));
-			if (!SERIES_FREED(series)) {
-				if (IS_FREEABLE(series)) {
-					Free_Series(series);
-					count++;
-				} else
-					UNMARK_SERIES(series);
+	for (n = 0; n < SERIES_TAIL(GC_Remembered); n++) {
+		series = ((REBSER **)GC_Remembered->data)[n];
+		if (!SERIES_FREED(series) && (series->gen & (GEN_OLD|GEN_DIRTY)) == (GEN_OLD|GEN_DIRTY))
+			Mark_Series(series, 0);
+	}
+
+	series = VAL_SERIES(ROOT_ROOT);
+	for (val = BLK_HEAD(series), n = 0; n < SERIES_TAIL(series); n++, val++)
+		if (ANY_BLOCK(val)) Mark_Series(VAL_SERIES(val), 0);
+	for (val = BLK_HEAD(Task_Series), n = 0; n < SERIES_TAIL(Task_Series); n++, val++)
+		if (ANY_BLOCK(val)) Mark_Series(VAL_SERIES(val), 0);
+
+	for (seg = Mem_Pools[GOB_POOL].segs; seg; seg = seg->next) {
+		gob = (REBGOB *) (seg + 1);
+		for (n = Mem_Pools[GOB_POOL].units; n > 0; n--, gob++) {
+			if (!GC_Phase) {
+				if (IS_GOB_USED(gob)) Mark_Gob(gob, 0);
+			}
+			else if (IS_GOB_MARK(gob)) {
+				UNMARK_GOB(gob);
+				Mark_Gob(gob, 0);
 			}
-			series++;
-			SKIP_WALL(series);
 		}
 	}
-
-	return count;
 }
 
 
@@ -486,9 +1015,11 @@ mark_obj:
 	REBSEG	*seg;
 	REBGOB	*gob;
 	REBCNT  n;
-	REBCNT	count = 0;
+	REBINT	count;
 
-	for (seg = Mem_Pools[GOB_POOL].segs; seg; seg = seg->next) {
+	if (GC_Workers > 1 && (count = Sweep_Parallel(GOB_POOL)) >= 0) return count;
+
+	for (count = 0, seg = Mem_Pools[GOB_POOL].segs; seg; seg = seg->next) {
 		gob = (REBGOB *) (seg + 1);
 		for (n = Mem_Pools[GOB_POOL].units; n > 0; n--) {
 #ifdef MUNGWALL
@@ -516,42 +1047,56 @@ mark_obj:
 
 /***********************************************************************
 **
-*/	REBCNT Recycle(void)
+*/	static REBCNT Mark_Gray(REBCNT limit)
 /*
-**		Recycle memory no longer needed.
+**		Scan gray blocks (marked, but not scanned) from the mark
+**		stack until about limit values are done. Returns the number
+**		of values.
 **
 ***********************************************************************/
 {
-	REBINT n;
-	REBSER **sp;
-	REBCNT count;
-
-	//Debug_Num("GC", GC_Disabled);
-
-	// If disabled, exit now but set the pending flag.
-	if (GC_Disabled || !GC_Active) {
-		SET_SIGNAL(SIG_RECYCLE);
-		//Print("pending");
-		return 0;
+	REBGRY *gray;
+	REBSER *series;
+	REBCNT index;
+	REBCNT work = 0;
+
+	while (work < limit && SERIES_TAIL(GC_Gray) > 0) {
+		gray = (REBGRY *)GC_Gray->data + --GC_Gray->tail;
+		series = gray->series;
+		index = gray->index;
+		// It may have been freed (and made again), or scanned:
+		if (SERIES_FREED(series) || !(series->gen & GEN_GRAY)) continue;
+		work += MIN(SERIES_TAIL(series) - MIN(index, SERIES_TAIL(series)), GC_SCAN_PART) + 1;
+		if (index == 0) Mark_Series(series, 0);
+		else {
+			// The rest of a large block:
+			series->gen &= ~GEN_GRAY;
+			if (GC_Snap) {
+				GC_Snap->from = Snap_Id(series, 0);
+				GC_Snap->last = 0;
+			}
+			Mark_Values(series, index, 1);
+			if (GC_Snap) GC_Snap->from = GC_Snap->last = 0;
+		}
 	}
 
-	if (Reb_Opts->watch_recycle) Debug_Str(BOOT_STR(RS_WATCH, 0));
-
-	GC_Disabled = 1;
+	return work;
+}
 
-	PG_Reb_Stats->Recycle_Counter++;
-	PG_Reb_Stats->Recycle_Series = Mem_Pools[SERIES_POOL].free;
 
-	PG_Reb_Stats->Mark_Count = 0;
+/***********************************************************************
+**
+*/	static void Mark_Roots(void)
+/*
+**		Mark the series that are in use by the system and by
+**		the natives that are running.
+**
+***********************************************************************/
+{
+	REBINT n;
+	REBSER **sp;
 
-	// WARNING: These terminate existing open blocks. This could
-	// be a problem if code is building a new value at the tail,
-	// but has not yet updated the TAIL marker.
-	DS_TERMINATE; // Update data stack tail
-//	SET_END(DS_NEXT);
-	VAL_BLK_TERM(TASK_BUF_EMIT);
-	VAL_BLK_TERM(TASK_BUF_WORDS);
-//!!!	SET_END(BLK_TAIL(Save_Value_List));
+	TERMINATE_BUFFERS;
 
 	// Mark series stack (temp-saved series):
 	sp = (REBSER **)GC_Protect->data;
@@ -582,7 +1127,143 @@ mark_obj:
 
 	// Mark all devices:
 	Mark_Devices(0);
-	
+}
+
+
+#ifdef GC_VERIFY
+/***********************************************************************
+**
+*/	static REBSER **Verify_Minor(REBSER **live)
+/*
+**		Check the write barrier (GC_VERIFY builds only). Before the
+**		marking of a minor recycle, mark all the heap, as a full one
+**		would, and return the list of new series found (clearing the
+**		marks). After it, check that each of them was marked again.
+**		If not, a block it was stored in did not use REMEMBER_SERIES:
+**		list the old blocks that refer to it, and crash.
+**
+***********************************************************************/
+{
+	REBSEG	*seg;
+	REBSER	*series;
+	REBGOB	*gob;
+	REBVAL	*val;
+	REBCNT	count = 0;
+	REBCNT	missed = 0;
+	REBCNT	n;
+	REBCNT	i;
+
+	if (!live) {
+		live = Make_Mem((Mem_Pools[SERIES_POOL].has + 1) * sizeof(REBSER *));
+		GC_Minor = FALSE;
+		RESET_TAIL(GC_Frames); // (all found again)
+		Mark_Roots();
+		Mark_Gray(ALL_BITS);
+		GC_Minor = TRUE;
+		for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
+			series = (REBSER *)(seg + 1);
+			for (n = Mem_Pools[SERIES_POOL].units; n > 0; n--) {
+				SKIP_WALL(series);
+				if (!SERIES_FREED(series) && IS_MARK_SERIES(series)) {
+					if (!IS_OLD_SERIES(series)) live[count++] = series;
+					UNMARK_SERIES(series);
+				}
+				series++;
+				SKIP_WALL(series);
+			}
+		}
+		live[count] = 0;
+		for (seg = Mem_Pools[GOB_POOL].segs; seg; seg = seg->next) {
+			gob = (REBGOB *)(seg + 1);
+			for (n = Mem_Pools[GOB_POOL].units; n > 0; n--, gob++)
+				if (IS_GOB_USED(gob)) UNMARK_GOB(gob);
+		}
+		return live;
+	}
+
+	for (n = 0; live[n]; n++) {
+		if (IS_MARK_SERIES(live[n])) continue;
+		missed++;
+		Debug_Fmt("Minor recycle missed series %x (wide %d tail %d)",
+			live[n], SERIES_WIDE(live[n]), SERIES_TAIL(live[n]));
+		for (seg = Mem_Pools[SERIES_POOL].segs; seg; seg = seg->next) {
+			series = (REBSER *)(seg + 1);
+			for (i = Mem_Pools[SERIES_POOL].units; i > 0; i--) {
+				SKIP_WALL(series);
+				if (!SERIES_FREED(series) && IS_OLD_SERIES(series) && IS_BLOCK_SERIES(series)) {
+					for (val = BLK_HEAD(series); NOT_END(val); val++) {
+						if ((ANY_SERIES(val) && VAL_SERIES(val) == live[n])
+							|| (ANY_OBJECT(val) && VAL_OBJ_FRAME(val) == live[n])
+							|| (ANY_FUNC(val) && VAL_FUNC_BODY(val) == live[n]))
+							Debug_Fmt("  from old block %x (gen %x) at %d",
+								series, series->gen, val - BLK_HEAD(series));
+					}
+				}
+				series++;
+				SKIP_WALL(series);
+			}
+		}
+	}
+
+	Free_Mem(live, (Mem_Pools[SERIES_POOL].has + 1) * sizeof(REBSER *));
+	if (missed) Crash(RP_MISSED_BARRIER);
+	return 0;
+}
+#endif
+
+
+/***********************************************************************
+**
+*/	static REBCNT Collect_Garbage(REBFLG minor)
+/*
+**		Recycle memory no longer needed. If minor, only the
+**		series made since the last recycle (see notes above).
+**
+***********************************************************************/
+{
+	REBCNT count;
+#ifdef GC_VERIFY
+	REBSER **live = 0;
+#endif
+
+	//Debug_Num("GC", GC_Disabled);
+
+	// If disabled, exit now but set the pending flag.
+	if (GC_Disabled || !GC_Active) {
+		SET_SIGNAL(SIG_RECYCLE);
+		//Print("pending");
+		return 0;
+	}
+
+	if (Reb_Opts->watch_recycle) Debug_Str(BOOT_STR(RS_WATCH, 0));
+
+	GC_Disabled = 1;
+	GC_Minor = minor;
+	// Minor recycles can follow a full one only if it has the frames:
+	GC_Minors = minor ? GC_Minors + 1 : (GC_Generational ? 0 : GC_MINOR_MAX);
+
+	PG_Reb_Stats->Recycle_Counter++;
+	PG_Reb_Stats->Recycle_Series = Mem_Pools[SERIES_POOL].free;
+
+	PG_Reb_Stats->Mark_Count = 0;
+
+	// A full recycle finds all the frames:
+	if (!minor) RESET_TAIL(GC_Frames);
+
+#ifdef GC_VERIFY
+	if (minor) live = Verify_Minor(0);
+#endif
+
+	Mark_Roots();
+
+	if (minor) Mark_Old_Series();
+
+	Mark_Gray(ALL_BITS);
+
+#ifdef GC_VERIFY
+	if (minor) Verify_Minor(live);
+#endif
+
 	count = Sweep_Series();
 	count += Sweep_Gobs();
 
@@ -596,7 +1277,14 @@ mark_obj:
 	// Reset stack to prevent invalid MOLD access:
 	RESET_TAIL(DS_Series);
 
+	// No series are new now, so none need to be remembered:
+	RESET_TAIL(GC_Remembered);
+
+	// The GC lists have no freed series now:
+	if (!minor) Trim_Pools();
+
 	GC_Ballast = VAL_INT32(TASK_BALLAST);
+	GC_Minor = FALSE;
 	GC_Disabled = 0;
 
 	if (Reb_Opts->watch_recycle) Debug_Fmt(BOOT_STR(RS_WATCH, 1), count);
@@ -604,6 +1292,231 @@ mark_obj:
 }
 
 
+/***********************************************************************
+**
+*/	static REBCNT Collect_Slice(REBCNT limit)
+/*
+**		Do the next slice of an incremental recycle (about limit
+**		values or series), or start one. Returns series freed.
+**
+**		Marking starts with the roots, then scans the gray blocks
+**		in slices. Code runs between the slices, and may store a
+**		white (unmarked) series into a black (scanned) block. So to
+**		end the marking, with no black block referring to a white
+**		series, the roots, frames, and the black blocks that were
+**		changed or are new are scanned again, in one slice. Then
+**		the series are swept, a segment at a time.
+**
+***********************************************************************/
+{
+	REBCNT count = 0;
+	REBCNT work;
+
+	if (GC_Phase == GC_IDLE) {
+		PG_Reb_Stats->Recycle_Counter++;
+		PG_Reb_Stats->Recycle_Series = 0;
+		PG_Reb_Stats->Mark_Count = 0;
+		// It has only the frames found by this one:
+		GC_Minors = GC_MINOR_MAX;
+		RESET_TAIL(GC_Frames);
+		RESET_TAIL(GC_Remembered);
+		GC_Phase = GC_MARKING;
+		Mark_Roots();
+		return 0;
+	}
+
+	if (GC_Phase == GC_MARKING) {
+		if (SERIES_TAIL(GC_Gray) > 0) {
+			TERMINATE_BUFFERS;
+			Mark_Gray(limit);
+			return 0;
+		}
+		Mark_Roots();
+		Mark_Old_Series();
+		Mark_Gray(ALL_BITS);
+		count = Sweep_Gobs();
+		// Reset stack to prevent invalid MOLD access:
+		RESET_TAIL(DS_Series);
+		GC_Sweep_Seg = Mem_Pools[SERIES_POOL].segs;
+		GC_Phase = GC_SWEEPING;
+		return count;
+	}
+
+	// Segments made since sweeping began have only new series:
+	for (work = 0; work < limit && GC_Sweep_Seg; GC_Sweep_Seg = GC_Sweep_Seg->next) {
+		count += Sweep_Segment(GC_Sweep_Seg);
+		work += Mem_Pools[SERIES_POOL].units;
+	}
+	PG_Reb_Stats->Recycle_Series += count;
+
+	if (!GC_Sweep_Seg) {
+		CHECK_MEMORY(4);
+		PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
+		PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
+		RESET_TAIL(GC_Remembered);
+		GC_Phase = GC_IDLE;
+		Trim_Pools();
+	}
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Recycle_Slice(void)
+/*
+**		Do a slice of the incremental recycle. It runs when a part
+**		of the ballast runs out, and while waiting (Wait_Ports).
+**
+***********************************************************************/
+{
+	REBCNT count;
+
+	if (GC_Disabled || !GC_Active) {
+		SET_SIGNAL(SIG_RECYCLE);
+		return 0;
+	}
+
+	GC_Disabled = 1;
+	count = Collect_Slice(GC_Slice);
+	GC_Ballast = VAL_INT32(TASK_BALLAST);
+	if (GC_Phase) GC_Ballast /= GC_PACE;
+	GC_Disabled = 0;
+
+	return count;
+}
+
+
+/***********************************************************************
+**
+*/	void Finish_Recycle(void)
+/*
+**		Finish the incremental recycle in progress, if any. It must
+**		be done before the mark flags are used for anything else.
+**
+***********************************************************************/
+{
+	if (!GC_Phase) return;
+
+	DISABLE_GC;
+	while (GC_Phase) Collect_Slice(ALL_BITS);
+	ENABLE_GC;
+
+	GC_Ballast = VAL_INT32(TASK_BALLAST);
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Recycle(void)
+/*
+**		Recycle all memory no longer needed.
+**
+***********************************************************************/
+{
+	Finish_Recycle();
+	return Collect_Garbage(FALSE);
+}
+
+
+/***********************************************************************
+**
+*/	REBSER *Snap_Heap(void)
+/*
+**		Recycle, and record each series that is marked, and each
+**		reference to it, as a graph. Returns it as a binary (read
+**		by src/tools/heap-diff.r), or zero if recycling is off:
+**
+**			"R3HS" version nodes edges (32 bits, LSB first)
+**			nodes: parent bytes tail (32 bits) type wide (8 bits)
+**			edges: from to (32 bits)
+**
+**		Nodes have ids from 1, in the order they were found. The
+**		parent is the block that first referred to the series (zero
+**		for a root), so the parents give a path that retains it.
+**		The type is that of the value in the parent that refers to
+**		it (zero if internal, as for word lists).
+**
+***********************************************************************/
+{
+	REBSNP snap;
+	REBSER *ser = 0;
+	REBCNT size;
+	REBYTE *bp;
+
+	Finish_Recycle();
+
+	CLEARS(&snap);
+	snap.room = snap.edge_room = 4096;
+	snap.size = 8192;
+	snap.nodes = Make_Mem(snap.room * SNAP_NODE);
+	snap.edges = Make_Mem(snap.edge_room * SNAP_EDGE);
+	snap.keys = Make_Mem(snap.size * sizeof(REBSER *));
+	snap.ids = Make_Mem(snap.size * sizeof(REBCNT));
+
+	GC_Snap = &snap;
+	Recycle();
+	GC_Snap = 0;
+
+	if (snap.count > 0 && !snap.full) {
+		size = 16 + snap.count * SNAP_NODE + snap.links * SNAP_EDGE;
+		ser = Make_Binary(size);
+		bp = BIN_HEAD(ser);
+		memcpy(bp, "R3HS", 4);
+		Put_Snap_Int(bp + 4, 1);
+		Put_Snap_Int(bp + 8, snap.count);
+		Put_Snap_Int(bp + 12, snap.links);
+		memcpy(bp + 16, snap.nodes, snap.count * SNAP_NODE);
+		memcpy(bp + 16 + snap.count * SNAP_NODE, snap.edges, snap.links * SNAP_EDGE);
+		SERIES_TAIL(ser) = size;
+	}
+
+	Free_Mem(snap.nodes, snap.room * SNAP_NODE);
+	Free_Mem(snap.edges, snap.edge_room * SNAP_EDGE);
+	Free_Mem(snap.keys, snap.size * sizeof(REBSER *));
+	Free_Mem(snap.ids, snap.size * sizeof(REBCNT));
+
+	if (snap.full) Trap0(RE_NO_MEMORY);
+
+	return ser;
+}
+
+
+/***********************************************************************
+**
+*/	REBCNT Recycle_Auto(void)
+/*
+**		Recycle when the ballast runs out. With generational
+**		recycle on, it is a minor one, except every GC_MINOR_MAX
+**		times (old garbage must be freed too). With incremental
+**		recycle on, it is the next slice.
+**
+***********************************************************************/
+{
+	if (GC_Slice) return Recycle_Slice();
+	return Collect_Garbage(GC_Generational && GC_Minors < GC_MINOR_MAX);
+}
+
+
+/***********************************************************************
+**
+*/	void Remember_Series(REBSER *series)
+/*
+**		Write barrier for an old block that was not written since
+**		the last recycle (see REMEMBER_SERIES). It may now refer to
+**		new series, so the next minor recycle must scan it (or the
+**		end of the incremental marking, if it is black).
+**
+***********************************************************************/
+{
+	series->gen |= GEN_DIRTY;
+	// (The first recycle after it is turned on is a full one.)
+	if (GC_Generational || GC_Phase == GC_MARKING)
+		APPEND_SERIES_PTR(GC_Remembered, series);
+}
+
+
 /***********************************************************************
 **
 */	void Save_Series(REBSER *series)
@@ -663,6 +1576,13 @@ mark_obj:
 	GC_Disabled = 0;		// GC disabled counter for critical sections.
 	GC_Ballast = MEM_BALLAST;
 	GC_Last_Infant = 0;		// Keep the last N series safe from GC.
+	GC_Generational = FALSE; // Auto-recycle all series (see RECYCLE func)
+	GC_Minor = FALSE;
+	GC_Minors = 0;
+	GC_Slice = 0;			// Auto-recycle all at once (see RECYCLE func)
+	GC_Workers = 0;			// Sweep on this thread only (see RECYCLE func)
+	GC_Phase = GC_IDLE;
+	GC_Sweep_Seg = 0;
 	GC_Infants = Make_Mem((MAX_SAFE_SERIES + 2) * sizeof(REBSER*)); // extra
 
 	Init_Pools(scale);
@@ -676,4 +1596,14 @@ mark_obj:
 
 	GC_Series = Make_Series(60, sizeof(REBSER *), FALSE);
 	KEEP_SERIES(GC_Series, "gc guarded");
+
+	// Old frames, and old blocks written since the last recycle:
+	GC_Frames = Make_Series(60, sizeof(REBSER *), FALSE);
+	KEEP_SERIES(GC_Frames, "gc frames");
+	GC_Remembered = Make_Series(60, sizeof(REBSER *), FALSE);
+	KEEP_SERIES(GC_Remembered, "gc remembered");
+
+	// Blocks to scan, for an incremental recycle:
+	GC_Gray = Make_Series(60, sizeof(REBGRY), FALSE);
+	KEEP_SERIES(GC_Gray, "gc gray");
 }
@@ -57,6 +57,12 @@
 
 //#define GC_TRIGGER (GC_Active && (GC_Ballast <= 0 || (GC_Pending && !GC_Disabled)))
 
+#ifdef MUNGWALL
+#define NODE_SPAN(p) ((p)->wide + 2 * MUNG_SIZE)
+#else
+#define NODE_SPAN(p) ((p)->wide)
+#endif
+
 #ifdef POOL_MAP
 #define FIND_POOL(n) ((n <= 4 * MEM_BIG_SIZE) ? (REBCNT)(PG_Pool_Map[n]) : SYSTEM_POOL)
 #else
@@ -118,12 +124,34 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 {
 	void *ptr;
 
-	if (!(ptr = malloc(size))) return 0;
+	// (New memory from the OS is clear already, so calloc skips it)
+	if (!(ptr = calloc(1, size))) return 0;
 	PG_Mem_Usage += size;
 	if (PG_Mem_Limit != 0 && (PG_Mem_Usage > PG_Mem_Limit)) {
 		Check_Security(SYM_MEMORY, POL_EXEC, 0);
 	}
-	CLEAR(ptr, size);
+
+	return ptr;
+}
+
+
+/***********************************************************************
+**
+*/	void *Resize_Mem(void *mem, size_t size, size_t new_size)
+/*
+**		Change the size of memory from Make_Mem, keeping what it
+**		holds. What is added is not cleared. Returns zero if there
+**		is not enough memory (and the old memory is kept).
+**
+***********************************************************************/
+{
+	REBYTE *ptr;
+
+	if (PG_Mem_Limit != 0 && (PG_Mem_Usage + new_size - size > PG_Mem_Limit)) {
+		Check_Security(SYM_MEMORY, POL_EXEC, 0);
+	}
+	if (!(ptr = realloc(mem, new_size))) return 0;
+	PG_Mem_Usage += new_size - size;
 
 	return ptr;
 }
@@ -140,6 +168,114 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 }
 
 
+/***********************************************************************
+**
+*/	static void *Make_Data_Mem(size_t size)
+/*
+**		Allocate the data of a series too big for the pools. If it
+**		is very big (MEM_MAP_SIZE), it is mapped from the OS, so it
+**		can use huge pages and is given back as soon as it is freed
+**		(rather than fragment the C library heap).
+**
+***********************************************************************/
+{
+	void *ptr;
+
+	if (size < MEM_MAP_SIZE) return Make_Mem(size);
+
+	if (!(ptr = OS_MAP_MEM(size))) return 0;
+	PG_Mem_Usage += size;
+	if (PG_Mem_Limit != 0 && (PG_Mem_Usage > PG_Mem_Limit)) {
+		Check_Security(SYM_MEMORY, POL_EXEC, 0);
+	}
+
+	return ptr;
+}
+
+
+/***********************************************************************
+**
+*/	static void *Resize_Data_Mem(void *mem, size_t size, size_t new_size)
+/*
+**		Resize series data from Make_Data_Mem, as Resize_Mem does.
+**		Mapped data is remapped. Returns zero if it cannot be done,
+**		as when it would have to move from the heap to be mapped.
+**
+***********************************************************************/
+{
+	void *ptr;
+
+	if (new_size < MEM_MAP_SIZE) return Resize_Mem(mem, size, new_size);
+	if (size < MEM_MAP_SIZE) return 0;
+
+	if (PG_Mem_Limit != 0 && (PG_Mem_Usage + new_size - size > PG_Mem_Limit)) {
+		Check_Security(SYM_MEMORY, POL_EXEC, 0);
+	}
+	if (!(ptr = OS_REMAP_MEM(mem, size, new_size))) return 0;
+	PG_Mem_Usage += new_size - size;
+
+	return ptr;
+}
+
+
+/***********************************************************************
+**
+*/	static void Free_Data_Mem(void *mem, size_t size)
+/*
+**		Free series data from Make_Data_Mem.
+**
+***********************************************************************/
+{
+	if (size < MEM_MAP_SIZE) {
+		Free_Mem(mem, size);
+		return;
+	}
+	PG_Mem_Usage -= size;
+	OS_UNMAP_MEM(mem, size);
+}
+
+
+/***********************************************************************
+**
+*/	static void Tune_Pools(void)
+/*
+**		Set the units per segment of pools from the REBOL_POOLS
+**		environment variable, for programs that make many series
+**		of some sizes. It holds size:units pairs, where size is a
+**		series size in bytes (for the pool that holds it), or the
+**		word series or gobs (for the pools of their headers):
+**
+**			REBOL_POOLS="series:16384 48:4096"
+**
+***********************************************************************/
+{
+	REBCHR env[256];
+	REBCHR *cp = env;
+	REBCNT size;
+	REBCNT units;
+	REBCNT pool;
+	REBINT len = OS_GET_ENV((REBCHR *)TXT("REBOL_POOLS"), env, 256);
+
+	// Too long (len is the size needed), or not set:
+	if (len <= 0 || len >= 256) return;
+	env[len] = 0; // (the host may not terminate it)
+
+	while (*cp) {
+		if (*cp == 's') pool = SERIES_POOL;
+		else if (*cp == 'g') pool = GOB_POOL;
+		else if (*cp >= '0' && *cp <= '9') {
+			for (size = 0; *cp >= '0' && *cp <= '9'; cp++) size = size * 10 + (*cp - '0');
+			pool = (size <= 4 * MEM_BIG_SIZE) ? FIND_POOL(size) : SYSTEM_POOL;
+		}
+		else {cp++; continue;}
+		while (*cp && *cp != ':') cp++;
+		if (!*cp) break;
+		for (units = 0, cp++; *cp >= '0' && *cp <= '9'; cp++) units = units * 10 + (*cp - '0');
+		if (pool < SYSTEM_POOL && units >= 2) Mem_Pools[pool].units = units;
+	}
+}
+
+
 /***********************************************************************
 **
 */	void Init_Pools(REBINT scale)
@@ -168,6 +304,8 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	for (; n <= 16 * MEM_MIN_SIZE; n++) PG_Pool_Map[n] = MEM_TINY_POOL     + ((n-1) / MEM_MIN_SIZE);
 	for (; n <= 32 * MEM_MIN_SIZE; n++) PG_Pool_Map[n] = MEM_SMALL_POOLS-4 + ((n-1) / (MEM_MIN_SIZE * 4));
 	for (; n <=  4 * MEM_BIG_SIZE; n++) PG_Pool_Map[n] = MEM_MID_POOLS     + ((n-1) / MEM_BIG_SIZE);
+
+	Tune_Pools();
 }
 
 
@@ -211,49 +349,43 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 /*
 **		Allocate memory for a pool.  The amount allocated will be
 **		determined from the size and units specified when the
-**		pool header was created.  The nodes of the pool are linked
-**		to the free list.
+**		pool header was created.
+**
+**		The nodes are not linked to the free list, but are taken
+**		in order by Make_Node, so the pages of the segment are not
+**		touched until used.
 **
 ***********************************************************************/
 {
 	REBSEG	*seg;
-	REBNOD	*node;
-	REBYTE	*next;
 	REBCNT	units = pool->units;
+	REBCNT	mem_size = NODE_SPAN(pool) * units + sizeof(REBSEG);
 #ifdef MUNGWALL
-	REBCNT	mem_size = (pool->wide + 2 * MUNG_SIZE) * units + sizeof(REBSEG);
-#else
-	REBCNT	mem_size = pool->wide * units + sizeof(REBSEG);
+	REBYTE	*next;
 #endif
 
+	// (Make_Mem clears it, as needed for series nodes)
 	seg = (REBSEG *) Make_Mem(mem_size);
 	if (!seg) Crash(RP_NO_MEMORY, mem_size);
 
-	CLEAR(seg, mem_size);  // needed to clear series nodes
 	seg->size = mem_size;
 	seg->next = pool->segs;
    	pool->segs = seg;
 	pool->free += units;
 	pool->has += units;
+	pool->trim = 0;
 
-	// Add new nodes to the end of free list:
-	for (node = (REBNOD *)&pool->first; *node; node = *node);	// goto end
+	pool->fresh = (REBYTE *)(seg + 1);
+	pool->left = units;
 
 #ifdef MUNGWALL
-	for (next = (REBYTE *)(seg + 1); units > 0; units--) {
+	for (next = pool->fresh; units > 0; units--) {
 		memcpy(next,MUNG_PATTERN1,MUNG_SIZE);
 		memcpy(next+MUNG_SIZE+pool->wide,MUNG_PATTERN2,MUNG_SIZE);
-		*node = (REBNOD) (next+MUNG_SIZE);
-		node  = *node;
 		next+=pool->wide+2*MUNG_SIZE;
 	}
-#else
-	for (next = (REBYTE *)(seg + 1); units > 0; units--, next += pool->wide) {
-		*node = (REBNOD) next;
-		node  = *node;
-	}
+	pool->fresh += MUNG_SIZE;
 #endif
-	*node = 0;
 }
 
 
@@ -264,15 +396,22 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 **		Allocate a node from a pool.  The node will NOT be cleared.
 **		If the pool has run out of nodes, it will be refilled.
 **
+**		Freed nodes are used first, then those of the newest
+**		segment in address order.
+**
 ***********************************************************************/
 {
 	REBNOD *node;
 	REBPOL *pool;
 
 	pool = &Mem_Pools[pool_id];
-	if (!pool->first) Fill_Pool(pool);
-	node = pool->first;
-	pool->first = *node;
+	if (NZ(node = pool->first)) pool->first = *node;
+	else {
+		if (!pool->left) Fill_Pool(pool);
+		node = (REBNOD *)pool->fresh;
+		pool->fresh += NODE_SPAN(pool);
+		pool->left--;
+	}
 	pool->free--;
 	return (void *)node;
 }
@@ -293,6 +432,135 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 }
 
 
+/***********************************************************************
+**
+*/	static int Compare_Segs(const void *s1, const void *s2)
+/*
+***********************************************************************/
+{
+	REBUPT a = (REBUPT)*(REBSEG **)s1;
+	REBUPT b = (REBUPT)*(REBSEG **)s2;
+
+	return (a > b) ? 1 : (a < b) ? -1 : 0;
+}
+
+
+/***********************************************************************
+**
+*/	static REBCNT Find_Seg(REBSEG **segs, REBCNT count, REBNOD *node)
+/*
+**		Return the index of the segment that holds the node, from
+**		a list of segments in address order.
+**
+***********************************************************************/
+{
+	REBCNT lo = 0;
+	REBCNT n;
+
+	while (count > 1) {
+		n = count / 2;
+		if ((REBUPT)node >= (REBUPT)segs[lo + n]) lo += n, count -= n;
+		else count = n;
+	}
+
+	return lo;
+}
+
+
+/***********************************************************************
+**
+*/	static void Trim_Pool(REBPOL *pool)
+/*
+**		Free the segments of a pool that have no nodes in use. To
+**		find them, the free nodes are counted for each segment.
+**
+**		A quarter of the pool is kept free, so it need not be
+**		filled again right away.
+**
+***********************************************************************/
+{
+	REBCNT	units = pool->units;
+	REBCNT	count = pool->has / units;
+	REBSEG	**segs;
+	REBCNT	*frees;
+	REBSEG	*seg;
+	REBNOD	*node;
+	REBCNT	released = 0;
+	REBCNT	n;
+
+	segs = Make_Mem(count * sizeof(REBSEG *));
+	frees = Make_Mem(count * sizeof(REBCNT));
+
+	for (n = 0, seg = pool->segs; seg; seg = seg->next) segs[n++] = seg;
+	qsort(segs, count, sizeof(REBSEG *), Compare_Segs);
+
+	for (node = pool->first; node; node = *node) frees[Find_Seg(segs, count, node)]++;
+	if (pool->left) frees[Find_Seg(segs, count, (REBNOD *)pool->fresh)] += pool->left;
+
+	// Free the highest first (which may shrink the heap):
+	for (n = count; n > 0 && pool->free * 4 >= pool->has + 3 * units; n--) {
+		if (frees[n - 1] != units) continue;
+		frees[n - 1] = NOT_FOUND; // (freed)
+		pool->free -= units;
+		pool->has -= units;
+		released++;
+	}
+	pool->trim = pool->free;
+
+	if (released) {
+		if (pool->left && frees[Find_Seg(segs, count, (REBNOD *)pool->fresh)] == NOT_FOUND)
+			pool->left = 0;
+		// Unlink the nodes and segments freed:
+		for (node = (REBNOD *)&pool->first; *node;) {
+			if (frees[Find_Seg(segs, count, *node)] == NOT_FOUND) *node = *(REBNOD *)*node;
+			else node = *node;
+		}
+		pool->segs = 0;
+		for (n = 0; n < count; n++) {
+			if (frees[n] == NOT_FOUND) {
+				PG_Reb_Stats->Segs_Released++;
+				PG_Reb_Stats->Bytes_Released += segs[n]->size;
+				Free_Mem(segs[n], segs[n]->size);
+			}
+			else {
+				segs[n]->next = pool->segs;
+				pool->segs = segs[n];
+			}
+		}
+	}
+
+	Free_Mem(segs, count * sizeof(REBSEG *));
+	Free_Mem(frees, count * sizeof(REBCNT));
+}
+
+
+/***********************************************************************
+**
+*/	void Trim_Pools(void)
+/*
+**		Return the memory of empty pool segments to the OS. Done
+**		after a full recycle, for the pools that are mostly free
+**		(and have more free than when last trimmed).
+**
+**		Pointers to freed series must not remain (in the GC lists,
+**		for example), as their memory may be gone.
+**
+***********************************************************************/
+{
+	REBPOL	*pool;
+	REBCNT	segs = PG_Reb_Stats->Segs_Released;
+	REBCNT	n;
+
+	for (n = 0; n < SYSTEM_POOL; n++) {
+		pool = &Mem_Pools[n];
+		if (pool->free * 2 > pool->has && pool->free >= pool->trim + pool->units)
+			Trim_Pool(pool);
+	}
+
+	if (segs != PG_Reb_Stats->Segs_Released) OS_TRIM_MEM();
+}
+
+
 /***********************************************************************
 **
 */	REBSER *Make_Series_Data(REBSER *series, REBCNT length)
@@ -315,10 +583,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	pool_num = FIND_POOL(length);
 	if (pool_num < SYSTEM_POOL) {
 		pool = &Mem_Pools[pool_num];
-		if (!pool->first) Fill_Pool(pool);
-		node = pool->first;
-		pool->first = *node;
-		pool->free--;
+		node = (REBNOD *)Make_Node(pool_num);
 		length = pool->wide;
 	} else {
 		length = ALIGN(length, 2048);
@@ -328,7 +593,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 #ifdef MUNGWALL
 		node = (REBNOD *) Make_Mem(length+2*MUNG_SIZE);
 #else
-		node = (REBNOD *) Make_Mem(length);
+		node = (REBNOD *) Make_Data_Mem(length);
 #endif
 		if (!node) Trap0(RE_NO_MEMORY);
 #ifdef MUNGWALL
@@ -382,10 +647,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 	pool_num = FIND_POOL(length);
 	if (pool_num < SYSTEM_POOL) {
 		pool = &Mem_Pools[pool_num];
-		if (!pool->first) Fill_Pool(pool);
-		node = pool->first;
-		pool->first = *node;
-		pool->free--;
+		node = (REBNOD *)Make_Node(pool_num);
 		length = pool->wide;
 		memset(node, 0, length);
 	} else {
@@ -403,7 +665,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 #ifdef MUNGWALL
 		node = (REBNOD *) Make_Mem(length+2*MUNG_SIZE);
 #else
-		node = (REBNOD *) Make_Mem(length);
+		node = (REBNOD *) Make_Data_Mem(length);
 #endif
 		if (!node) {
 			Free_Node(SERIES_POOL, (REBNOD *)series);
@@ -420,11 +682,14 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 #ifdef CHAFF
 	memset((REBYTE *)node, 0xff, length);
 #endif
-	series->tail = series->size = 0;
+	series->tail = 0;
+	series->series = 0; // clears the whole union (size too)
 	SERIES_REST(series) = length / wide; //FIXME: This is based on the assumption that length is multiple of wide
 	series->data = (REBYTE *)node;
 	series->info = wide; // also clears flags
+	series->gen = (GC_Phase == GC_SWEEPING) ? GEN_SWEEP : 0;
 	LABEL_SERIES(series, "make");
+	if (Prof_Sites) Count_Series(series);
 
 	if ((GC_Ballast -= length) <= 0) SET_SIGNAL(SIG_RECYCLE);
 
@@ -438,6 +703,48 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 }
 
 
+/***********************************************************************
+**
+*/	REBFLG Grow_Series_Data(REBSER *series, REBCNT length)
+/*
+**		Resize the data of a large series (from system memory, not
+**		a pool) to hold length units. The C library (or the OS, if
+**		it is mapped) may do that in place, or remap its pages,
+**		rather than copy it. The space
+**		added is not cleared (space past the tail is not relied on,
+**		see CHAFF), so its pages are not touched until used.
+**
+**		Returns FALSE if it cannot be done (the series is the same).
+**
+***********************************************************************/
+{
+	REBCNT wide = SERIES_WIDE(series);
+	REBCNT size = SERIES_TOTAL(series);
+	REBCNT new_size = ALIGN(length * wide, 2048);
+	REBYTE *data;
+
+#ifdef MUNGWALL
+	return FALSE;
+#endif
+	if (SERIES_BIAS(series) || IS_EXT_SERIES(series) || GC_Stay_Dirty) return FALSE;
+	if ((REBU64)length * wide > MAX_I32) return FALSE;
+	if (FIND_POOL(size) < SYSTEM_POOL || FIND_POOL(new_size) < SYSTEM_POOL) return FALSE;
+
+	if (!(data = Resize_Data_Mem(series->data, size, new_size))) return FALSE;
+
+#ifdef CHAFF
+	memset(data + size, 0xff, new_size - size);
+#endif
+	series->data = data;
+	SERIES_REST(series) = new_size / wide;
+	Mem_Pools[SYSTEM_POOL].has += new_size - size;
+	PG_Reb_Stats->Series_Memory += new_size - size;
+	if ((GC_Ballast -= new_size - size) <= 0) SET_SIGNAL(SIG_RECYCLE);
+
+	return TRUE;
+}
+
+
 /***********************************************************************
 **
 */	void Free_Series_Data(REBSER *series, REBOOL protect)
@@ -488,7 +795,7 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 #ifdef MUNGWALL
 		Free_Mem(((REBYTE *)node)-MUNG_SIZE, size + MUNG_SIZE*2);
 #else
-		Free_Mem(node, size);
+		Free_Data_Mem(node, size);
 #endif
 		Mem_Pools[SYSTEM_POOL].has -= size;
 		Mem_Pools[SYSTEM_POOL].free--;
@@ -561,7 +868,11 @@ clear_header:
 ***********************************************************************/
 {
 	newser->info = oldser->info;
+	newser->gen = oldser->gen;
 	newser->size = oldser->size;
+	// A block keeps its MAP hash, but not its (now stale) code cells:
+	if (SERIES_WIDE(oldser) == sizeof(REBVAL))
+		newser->series = IS_CODE_SERIES(oldser->series) ? 0 : oldser->series;
 #ifdef SERIES_LABELS
 	newser->label = oldser->label;
 #endif
@@ -647,7 +958,7 @@ clear_header:
 		}
 		// The number of free nodes must agree with header:
 		if (
-			(Mem_Pools[pool_num].free != count) ||
+			(Mem_Pools[pool_num].free != count + Mem_Pools[pool_num].left) ||
 			(Mem_Pools[pool_num].free == 0 && Mem_Pools[pool_num].first != 0)
 		)
 			goto crash;
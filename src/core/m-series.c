@@ -54,6 +54,11 @@
 **		When expanded at the head, if bias space is available, it will
 **		be used (if it provides enough space).
 **
+**		A large series grows by half its size, so that appending to
+**		it stays linear, and in place if the C library can do it
+**		(see Grow_Series_Data). A small one grows by double if it was
+**		expanded recently (see Prior_Expand).
+**
 **		WARNING: never use direct pointers into the series data, as the
 **		series data can be relocated in memory.
 **
@@ -98,28 +103,43 @@
 			Debug_Fmt("Expand %x wide: %d tail: %d delta: %d", series, wide, series->tail, delta);
 		}
 
-		// Create a new series that is bigger.
-		// Have we recently expanded the same series?
-		x = 1;
-		n = (REBUPT)(Prior_Expand[0]);
-		do {
-			if (Prior_Expand[n] == series) {
-				x = series->tail + delta + 1; // Double the size
-				break;
-			}
-			if (++n >= MAX_EXPAND_LIST) n = 1;
-		} while (n != (REBUPT)(Prior_Expand[0]));
 #ifdef DEBUGGING
 		Print_Num("Expand:", series->tail + delta + 1);
 #endif
-		newser = Make_Series(series->tail + delta + x, wide, TRUE);
-		// If necessary, add series to the recently expanded list:
-		if (Prior_Expand[n] != series) {
-			n = (REBUPT)(Prior_Expand[0]) + 1;
-			if (n >= MAX_EXPAND_LIST) n = 1;
-			Prior_Expand[n] = series;
+		if ((size + extra) > EXPAND_LARGE) {
+			x = (series->tail + delta) / 2;
+			if ((REBU64)(series->tail + delta + x) * wide > MAX_I32)
+				x = MAX(MAX_I32 / wide, series->tail + delta + 1) - (series->tail + delta);
+			if (Grow_Series_Data(series, series->tail + delta + x)) {
+				memmove(series->data + start + extra, series->data + start, size - start);
+				series->tail += delta;
+				PG_Reb_Stats->Series_Expanded++;	// Metric
+				CHECK_MEMORY(3);
+				return;
+			}
+			newser = Make_Series(series->tail + delta + x, wide, FALSE);
+		}
+		else {
+			// Create a new series that is bigger.
+			// Have we recently expanded the same series?
+			x = 1;
+			n = (REBUPT)(Prior_Expand[0]);
+			do {
+				if (Prior_Expand[n] == series) {
+					x = series->tail + delta + 1; // Double the size
+					break;
+				}
+				if (++n >= MAX_EXPAND_LIST) n = 1;
+			} while (n != (REBUPT)(Prior_Expand[0]));
+			newser = Make_Series(series->tail + delta + x, wide, TRUE);
+			// If necessary, add series to the recently expanded list:
+			if (Prior_Expand[n] != series) {
+				n = (REBUPT)(Prior_Expand[0]) + 1;
+				if (n >= MAX_EXPAND_LIST) n = 1;
+				Prior_Expand[n] = series;
+			}
+			Prior_Expand[0] = (REBSER*)n; // start next search here
 		}
-		Prior_Expand[0] = (REBSER*)n; // start next search here
 		Prop_Series(newser, series);
 		//ENABLE_GC;
 
@@ -331,6 +351,9 @@
 
 	if (len <= 0) return;
 
+	// Its code cells no longer match it (see BLK_CODE):
+	if (IS_BLOCK_SERIES(series)) UNCOMPILE_BLOCK(series);
+
 	// Optimized case of head removal:
 	if (index == 0) {
 		if ((REBCNT)len > series->tail) len = series->tail;
@@ -198,6 +198,9 @@ enum {
 
 	// flags has PROT_SET bit (set or not)
 
+	// It uses the mark flags, as recycle does:
+	Finish_Recycle();
+
 	Check_Security(SYM_PROTECT, POL_WRITE, val);
 
 	if (D_REF(2)) SET_FLAG(flags, PROT_DEEP);
@@ -594,7 +597,7 @@ got_err:
 	REBCNT argnum = IS_FALSE(D_ARG(1)) ? 3 : 2;
 
 	if (IS_BLOCK(D_ARG(argnum)) && !D_REF(4) /* not using /ONLY */) {
-		DO_BLK(D_ARG(argnum));
+		DO_TAIL_BLK(D_ARG(argnum));
 		return R_TOS1;
 	} else {
 		return argnum == 2 ? R_ARG2 : R_ARG3;
@@ -621,7 +624,7 @@ got_err:
 {
 	if (IS_FALSE(D_ARG(1))) return R_NONE;
 	if (IS_BLOCK(D_ARG(2)) && !D_REF(3) /* not using /ONLY */) {
-		DO_BLK(D_ARG(2));
+		DO_TAIL_BLK(D_ARG(2));
 		return R_TOS1;
 	} else {
 		return R_ARG2;
@@ -717,14 +720,17 @@ got_err:
 			if (IS_END(blk)) break;
 			found = TRUE;
 			// Evaluate the case block
+			if (!all) {
+				DO_TAIL_BLK(blk);
+				return R_TOS1;
+			}
 			result = DO_BLK(blk);
-			if (!all) return R_TOS1;
 			if (THROWN(result) && Check_Error(result) >= 0) break;
 		}
 	}
 
 	if (!found && IS_BLOCK(result = D_ARG(4))) {
-		DO_BLK(result);
+		DO_TAIL_BLK(result);
 		return R_TOS1;
 	}
 
@@ -765,7 +771,7 @@ got_err:
 {
 	if (IS_FALSE(D_ARG(1))) {
 		if (IS_BLOCK(D_ARG(2)) && !D_REF(3) /* not using /ONLY */) {
-			DO_BLK(D_ARG(2));
+			DO_TAIL_BLK(D_ARG(2));
 			return R_TOS1;
 		} else {
 			return R_ARG2;
@@ -293,6 +293,8 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 	blk = D_REF(3) ? Clone_Block_Value(arg) : VAL_SERIES(arg);
 //	if (D_REF(3)) blk = Copy_Block_Deep(blk, VAL_INDEX(arg), VAL_TAIL(arg), COPY_DEEP);
 	Set_Block_Index(D_RET, blk, D_REF(3) ? 0 : VAL_INDEX(arg));
+	UNCOMPILE_BLOCK(blk);
+	REMEMBER_SERIES(blk);
 
 	if (rel)
 		Bind_Stack_Block(frame, blk); //!! needs deep
@@ -333,6 +335,7 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 		UNBIND(word);
 	}
 	else {
+		UNCOMPILE_BLOCK(VAL_SERIES(word));
 		Unbind_Block(VAL_BLK_DATA(word), D_REF(2) != 0);
 	}
 
@@ -391,7 +394,7 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 	if (ANY_WORD(word)) {
 		val = Get_Var(word);
 		if (IS_FRAME(val)) {
-			Init_Obj_Value(D_RET, VAL_WORD_FRAME(word));
+			Init_Obj_Value(D_RET, Word_Frame(word));
 			return R_RET;
 		}
 		if (!D_REF(2) && !IS_SET(val)) Trap1(RE_NO_VALUE, word);
@@ -451,6 +454,8 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 
 	// Special form: IN object block
 	if (IS_BLOCK(word) || IS_PAREN(word)) {
+		UNCOMPILE_BLOCK(VAL_SERIES(word));
+		REMEMBER_SERIES(VAL_SERIES(word));
 		Bind_Block(frame, VAL_BLK(word), BIND_DEEP);
 		return R_ARG2;
 	}
@@ -547,6 +552,7 @@ static int Check_Char_Range(REBVAL *val, REBINT limit)
 			// should be screened earlier (as is done in e.g. REDUCE, or for
 			// function arguments) so they don't even get into this function.
 			*word = *val;
+			NOTE_OP_SET(val);
 			if (is_blk) {
 				val++;
 				if (IS_END(val)) {
@@ -405,6 +405,7 @@
 				//if (index < tail) index++; // do not increment block.
 			}
 			else Trap_Arg(words);
+			NOTE_OP_SET(vars);
 		}
 
 		ds = Do_Blk(body, 0);
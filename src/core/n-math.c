@@ -494,6 +494,91 @@ compare:
 	return R_FALSE;
 }
 
+// Comparison ops, their strictness for Compare_Values, and result sense:
+static const struct {
+	REBFUN func;
+	REBINT strict;
+	REBFLG sense;
+} Compare_Ops[] = {
+	{N_equalq,				0, TRUE},
+	{N_not_equalq,			0, FALSE},
+	{N_strict_equalq,		2, TRUE},
+	{N_strict_not_equalq,	2, FALSE},
+	{N_sameq,				3, TRUE},
+	{N_lesserq,				-1, FALSE},
+	{N_lesser_or_equalq,	-2, FALSE},
+	{N_greaterq,			-2, TRUE},
+	{N_greater_or_equalq,	-1, TRUE},
+	{0, 0, 0}
+};
+
+/***********************************************************************
+**
+*/	REBFLG Do_Math_Op(REBVAL *func, REBVAL *val, REBVAL *arg)
+/*
+**		Evaluate a stock infix op of two integer! or decimal! values
+**		directly, without a function frame. The result replaces val.
+**		Returns FALSE if the op is not one of the stock math ops
+**		(ADD, SUBTRACT, MULTIPLY, and the comparisons), or if the
+**		result would overflow; the op is then called as usual
+**		(and traps the overflow).
+**
+***********************************************************************/
+{
+	REBVAL b = *arg; // (Compare_Values modifies it)
+	REBI64 num;
+	REBI64 n2;
+	REBI64 anum;
+	REBDEC d1;
+	REBDEC d2;
+	REBINT n;
+
+	if (VAL_GET_EXT(func) == REB_NATIVE) {
+		for (n = 0; Compare_Ops[n].func; n++) {
+			if (VAL_FUNC_CODE(func) == Compare_Ops[n].func) {
+				n = Compare_Values(val, &b, Compare_Ops[n].strict) ? Compare_Ops[n].sense : !Compare_Ops[n].sense;
+				SET_LOGIC(val, n);
+				return TRUE;
+			}
+		}
+		return FALSE;
+	}
+
+	if (VAL_GET_EXT(func) != REB_ACTION) return FALSE;
+	n = VAL_FUNC_ACT(func);
+	if (n != A_ADD && n != A_SUBTRACT && n != A_MULTIPLY) return FALSE;
+
+	if (IS_INTEGER(val) && IS_INTEGER(arg)) {
+		num = VAL_INT64(val);
+		n2 = VAL_INT64(arg);
+		switch (n) {
+		case A_ADD:
+			anum = (REBU64)num + (REBU64)n2;
+			if (((num < 0) == (n2 < 0)) && ((num < 0) != (anum < 0))) return FALSE;
+			break;
+		case A_SUBTRACT:
+			anum = (REBU64)num - (REBU64)n2;
+			if (((num < 0) != (n2 < 0)) && ((num < 0) != (anum < 0))) return FALSE;
+			break;
+		default:
+			// Products of 32 bit values cannot overflow:
+			if (num > MAX_I32 || num < MIN_I32 || n2 > MAX_I32 || n2 < MIN_I32) return FALSE;
+			anum = num * n2;
+		}
+		VAL_INT64(val) = anum;
+		return TRUE;
+	}
+
+	d1 = AS_DECIMAL(val);
+	d2 = AS_DECIMAL(arg);
+	if (n == A_ADD) d1 += d2;
+	else if (n == A_SUBTRACT) d1 -= d2;
+	else d1 *= d2;
+	if (!FINITE(d1)) return FALSE;
+	SET_DECIMAL(val, d1);
+	return TRUE;
+}
+
 /***********************************************************************
 **
 */	REBNATIVE(maximum)
@@ -329,6 +329,7 @@ static struct digest {
 
 	if (D_REF(2)) parent = VAL_OBJ_FRAME(D_ARG(3));
 
+	REMEMBER_SERIES(VAL_SERIES(value)); // rebound
 	frame = Construct_Object(parent, VAL_BLK_DATA(value), D_REF(4));
 	SET_OBJECT(D_RET, frame);
 
@@ -96,6 +96,17 @@
 		SET_INT32(TASK_BALLAST, 0);
 	}
 
+	if (D_REF(6)) // /generational
+		GC_Generational = IS_TRUE(D_ARG(7));
+
+	if (D_REF(8)) { // /incremental
+		Finish_Recycle();
+		GC_Slice = IS_INTEGER(D_ARG(9)) ? Int32s(D_ARG(9), 1) : 0;
+	}
+
+	if (D_REF(10)) // /parallel
+		GC_Workers = Int32s(D_ARG(11), 1);
+
 	count = Recycle();
 
 	DS_Ret_Int(count);
@@ -112,6 +123,7 @@
 	REBI64 n;
 	REBCNT flags = 0;
 	REBVAL *stats;
+	REBSER *ser;
 
 	if (D_REF(3)) {
 		VAL_TIME(ds) = OS_DELTA_TIME(PG_Boot_Time, 0) * 1000;
@@ -125,6 +137,13 @@
 		return R_RET;
 	}
 
+	if (D_REF(5)) {
+		Check_Security(SYM_DEBUG, POL_READ, 0);
+		if (!(ser = Snap_Heap())) return R_NONE;
+		Set_Binary(ds, ser);
+		return R_RET;
+	}
+
 	if (D_REF(2)) {
 		stats = Get_System(SYS_STANDARD, STD_STATS);
 		*ds = *stats;
@@ -158,6 +177,10 @@
 
 			stats++;
 			SET_INTEGER(stats, PG_Reb_Stats->Recycle_Counter);
+			stats++;
+			SET_INTEGER(stats, PG_Reb_Stats->Segs_Released);
+			stats++;
+			SET_INTEGER(stats, PG_Reb_Stats->Bytes_Released);
 		}
 		return R_RET;
 	}
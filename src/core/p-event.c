@@ -86,6 +86,7 @@ REBREQ *req;		//!!! move this global
 	// Append to tail if room:
 	if (SERIES_FULL(VAL_SERIES(state))) Crash(RP_MAX_EVENTS);
 	VAL_TAIL(state)++;
+	REMEMBER_SERIES(VAL_SERIES(state));
 	value = VAL_BLK_TAIL(state);
 	SET_END(value);
 	value--;
@@ -150,31 +150,32 @@ static REBCNT *CRC_Table;
 
 /***********************************************************************
 **
-*/	REBINT Hash_Word(REBYTE *str, REBINT len)
+*/	REBCNT Hash_Word(REBYTE *str, REBINT len)
 /*
-**		Return a case insensitive hash value for the string.
+**		Return a case insensitive hash value for the string: FNV-1a
+**		of its lowercase chars, with the high bits mixed down, as
+**		the symbol table uses all 32 bits (see Make_Word).
 **
 ***********************************************************************/
 {
 	REBINT m, n;
-	REBINT hash;
+	REBCNT hash = 2166136261u;
 	REBCNT ulen;
 
 	if (len < 0) len = LEN_BYTES(str);
 
-	hash = (REBINT)len + (REBINT)((REBYTE)LO_CASE(*str));
-
 	ulen = (REBCNT)len; // so the & operation later isn't for the wrong type
 
 	for (; ulen > 0; str++, ulen--) {
 		n = *str;
 		if (n > 127 && NZ(m = Decode_UTF8_Char(&str, &ulen))) n = m; // mods str, ulen
 		if (n < UNICODE_CASES) n = LO_CASE(n);
-		n = (REBYTE)((hash >> CRCSHIFTS) ^ (REBYTE)n); // drop upper 8 bits
-		hash = MASK_CRC(hash << 8) ^ (REBINT)CRC_Table[n];
+		hash = (hash ^ (REBCNT)n) * 16777619u;
 	}
 
-	return hash;
+	hash ^= hash >> 15;
+	hash *= 0x2C1B3C6Du;
+	return hash ^ (hash >> 12);
 }
 
 
@@ -812,10 +812,12 @@ STOID Mold_Function(REBVAL *value, REB_MOLD *mold)
 
 	Append_Byte(mold->series, '[');
 
-	Mold_Block_Series(mold, VAL_FUNC_SPEC(value), 0, 0); //// & ~(1<<MOPT_MOLD_ALL)); // Never literalize it (/all).
+	Mold_Block_Series(mold, VAL_FUNC_SPEC_OF(value), 0, 0); //// & ~(1<<MOPT_MOLD_ALL)); // Never literalize it (/all).
 
 	if (IS_FUNCTION(value) || IS_CLOSURE(value))
 		Mold_Block_Series(mold, VAL_FUNC_BODY(value), 0, 0);
+	else if (IS_REBCODE(value))
+		Mold_Block_Series(mold, Rebcode_Source(value), 0, 0);
 
 	Append_Byte(mold->series, ']');
 	End_Mold(mold);
@@ -1208,6 +1210,7 @@ STOID Mold_Error(REBVAL *value, REB_MOLD *mold, REBFLG molded)
 	case REB_NATIVE:
 	case REB_ACTION:
 	case REB_COMMAND:
+	case REB_REBCODE:
 		Mold_Function(value, mold);
 		break;
 
@@ -1245,7 +1248,6 @@ STOID Mold_Error(REBVAL *value, REB_MOLD *mold, REBFLG molded)
 		Mold_Event(value, mold);
 		break;
 
-	case REB_REBCODE:
 	case REB_OP:
 	case REB_FRAME:
 	case REB_HANDLE:
@@ -556,7 +556,11 @@ static struct {
 		return PE_NONE;
 	}
 
-	if (pvs->setval) TRAP_PROTECT(VAL_SERIES(pvs->value));
+	if (pvs->setval) {
+		TRAP_PROTECT(VAL_SERIES(pvs->value));
+		UNCOMPILE_BLOCK(VAL_SERIES(pvs->value));
+		REMEMBER_SERIES(VAL_SERIES(pvs->value));
+	}
 	pvs->value = VAL_BLK_SKIP(pvs->value, n);
 	// if valset - check PROTECT on block
 	//if (NOT_END(pvs->path+1)) Next_Path(pvs); return PE_OK;
@@ -616,8 +620,11 @@ static struct {
 	ser   = VAL_SERIES(value);
 
 	// Check must be in this order (to avoid checking a non-series value);
-	if (action >= A_TAKE && action <= A_SORT && IS_PROTECT_SERIES(ser))
-		Trap0(RE_PROTECTED);
+	if (action >= A_TAKE && action <= A_SORT) {
+		if (IS_PROTECT_SERIES(ser)) Trap0(RE_PROTECTED);
+		UNCOMPILE_BLOCK(ser);
+		REMEMBER_SERIES(ser);
+	}
 
 	switch (action) {
 
@@ -795,6 +802,8 @@ zero_blk:
 		if (SERIES_WIDE(ser) != SERIES_WIDE(VAL_SERIES(arg)))
 			Trap_Arg(arg);
 		if (IS_PROTECT_SERIES(VAL_SERIES(arg))) Trap0(RE_PROTECTED);
+		UNCOMPILE_BLOCK(VAL_SERIES(arg));
+		REMEMBER_SERIES(VAL_SERIES(arg));
 		if (index < tail && VAL_INDEX(arg) < VAL_TAIL(arg)) {
 			val = *VAL_BLK_DATA(value);
 			*VAL_BLK_DATA(value) = *VAL_BLK_DATA(arg);
@@ -839,6 +848,7 @@ zero_blk:
 			action = A_PICK;
 			goto repick;
 		}
+		UNCOMPILE_BLOCK(ser);
 		Shuffle_Block(value, D_REF(3));
 		break;
 
@@ -130,6 +130,10 @@ of_type:
 				Set_Block(value, Clone_Block(VAL_FUNC_BODY(value)));
 				Unbind_Block(VAL_BLK(value), TRUE);
 				break;
+			case REB_REBCODE:
+				Set_Block(value, Clone_Block(Rebcode_Source(value)));
+				Unbind_Block(VAL_BLK(value), TRUE);
+				break;
 			case REB_NATIVE:
 			case REB_COMMAND:
 			case REB_ACTION:
@@ -141,14 +145,14 @@ of_type:
 			}
 			break;
 		case OF_SPEC:
-			Set_Block(value, Clone_Block(VAL_FUNC_SPEC(value)));
+			Set_Block(value, Clone_Block(VAL_FUNC_SPEC_OF(value)));
 			Unbind_Block(VAL_BLK(value), TRUE);
 			break;
 		case OF_TYPES:
 			Set_Block(value, As_Typesets(VAL_FUNC_ARGS(value)));
 			break;
 		case OF_TITLE:
-			arg = BLK_HEAD(VAL_FUNC_SPEC(value));
+			arg = BLK_HEAD(VAL_FUNC_SPEC_OF(value));
 			for (; NOT_END(arg) && !IS_STRING(arg) && !IS_WORD(arg); arg++);
 			if (!IS_STRING(arg)) return R_NONE;
 			Set_String(value, Copy_Series(VAL_SERIES(arg)));
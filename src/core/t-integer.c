@@ -43,6 +43,41 @@
 }
 
 
+/***********************************************************************
+**
+*/	REBI64 Mul_Int(REBI64 num, REBI64 arg)
+/*
+**		Integer multiply with overflow check.
+**		Also used by rebcode MUL.I.
+**
+***********************************************************************/
+{
+	REBU64 p, a, b;
+	REBCNT a1, a0, b1, b0;
+	REBFLG sgn;
+
+	a = num;
+	sgn = (num < 0);
+	if (sgn) a = -a;
+	b = arg;
+	if (arg < 0) {
+		sgn = !sgn;
+		b = -b;
+	}
+	p = a * b;
+	a1 = a>>32;
+	a0 = a;
+	b1 = b>>32;
+	b0 = b;
+	if (
+		(a1 && b1)
+		|| ((REBU64)a0 * b1 + (REBU64)a1 * b0 > p >> 32)
+		|| ((p > (REBU64)MAX_I64) && (!sgn || (p > -(REBU64)MIN_I64)))
+	) Trap0(RE_OVERFLOW);
+	return sgn ? -p : p;
+}
+
+
 /***********************************************************************
 **
 */	REBTYPE(Integer)
@@ -55,9 +90,6 @@
 	REBI64 arg;
 	REBINT n;
 
-	REBU64 p, a, b; // for overflow detection
-	REBCNT a1, a0, b1, b0;
-	REBFLG sgn;
 	REBI64 anum;
 
 	num = VAL_INT64(val);
@@ -126,25 +158,7 @@
 		break;
 
 	case A_MULTIPLY:
-		a = num;
-		sgn = (num < 0);
-		if (sgn) a = -a;
-		b = arg;
-		if (arg < 0) {
-			sgn = !sgn;
-			b = -b;
-		}
-		p = a * b;
-		a1 = a>>32;
-		a0 = a;
-		b1 = b>>32;
-		b0 = b;
-		if (
-			(a1 && b1)
-			|| ((REBU64)a0 * b1 + (REBU64)a1 * b0 > p >> 32)
-			|| ((p > (REBU64)MAX_I64) && (!sgn || (p > -(REBU64)MIN_I64)))
-		) Trap0(RE_OVERFLOW);
-		num = sgn ? -p : p;
+		num = Mul_Int(num, arg);
 		break;
 
 	case A_DIVIDE:
@@ -211,6 +211,7 @@
 	REBCNT n;
 
 	if (IS_NONE(key)) return 0;
+	if (val) {REMEMBER_SERIES(series);}
 
 	// We may not be large enough yet for the hash table to
 	// be worthwhile, so just do a linear search:
@@ -264,6 +265,7 @@
 		// Add hash table:
 		//Print("hash added %d", series->tail);
 		series->series = hser = Make_Hash_Array(series->tail);
+		REMEMBER_SERIES(series);
 		Rehash_Hash(series);
 	}
 
@@ -429,6 +431,7 @@
 
 	if (size >= MIN_DICT) ser = Make_Hash_Array(size);
 	blk->series = ser;
+	REMEMBER_SERIES(blk);
 	Rehash_Hash(blk);
 }
 
@@ -74,7 +74,6 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 {
 	REBCNT i, len;
 	REBVAL *word, *val;
-	REBINT *binds; // for binding table
 
 	// Can be a word:
 	if (ANY_WORD(arg)) {
@@ -95,7 +94,6 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 	arg = VAL_BLK_DATA(arg);
 
 	// Use binding table
-	binds = WORDS_HEAD(Bind_Table);
 	// Handle selfless
 	Collect_Start(IS_SELFLESS(obj) ? BIND_NO_SELF | BIND_ALL : BIND_ALL);
 	// Setup binding table with obj words:
@@ -111,7 +109,7 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 			Trap_Arg(word);
 		}
 
-		if (NZ(i = binds[VAL_WORD_CANON(word)])) {
+		if (NZ(i = Get_Bind(VAL_WORD_CANON(word)))) {
 			// bug fix, 'self is protected only in selfish frames:
 			if ((VAL_WORD_CANON(word) == SYM_SELF) && !IS_SELFLESS(obj)) {
 				// release binding table
@@ -121,7 +119,7 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 			}
 		} else {
 			// collect the word
-			binds[VAL_WORD_CANON(word)] = SERIES_TAIL(BUF_WORDS);
+			Set_Bind(VAL_WORD_CANON(word), SERIES_TAIL(BUF_WORDS));
 			EXPAND_SERIES_TAIL(BUF_WORDS, 1);
 			val = BLK_LAST(BUF_WORDS);
 			*val = *word;
@@ -140,7 +138,7 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 	// Set new values to obj words
 	for (word = arg; NOT_END(word); word += 2) {
 
-		i = binds[VAL_WORD_CANON(word)];
+		i = Get_Bind(VAL_WORD_CANON(word));
 		val = FRM_VALUE(obj, i);
 		if (GET_FLAGS(VAL_OPTS(FRM_WORD(obj, i)), OPTS_HIDE, OPTS_LOCK)) { 
 			// release binding table
@@ -151,7 +149,10 @@ static void Append_Obj(REBSER *obj, REBVAL *arg)
 		}
 
 		if (IS_END(word + 1)) SET_NONE(val);
-		else *val = word[1];
+		else {
+			*val = word[1];
+			NOTE_OP_SET(val);
+		}
 
 		if (IS_END(word + 1)) break; // fix bug#708
 	}
@@ -225,6 +226,7 @@ static REBSER *Trim_Object(REBSER *obj)
 ***********************************************************************/
 {
 	if (!IS_BLOCK(data)) return FALSE;
+	REMEMBER_SERIES(VAL_SERIES(data)); // rebound
 	VAL_OBJ_FRAME(out) = Construct_Object(0, VAL_BLK_DATA(data), 0);
 	VAL_SET(out, type);
 	if (type == REB_ERROR) {
@@ -247,7 +249,7 @@ static REBSER *Trim_Object(REBSER *obj)
 	}
 
 	if (IS_WORD(pvs->select)) {
-		n = Find_Word_Index(VAL_OBJ_FRAME(pvs->value), VAL_WORD_SYM(pvs->select), FALSE);
+		n = Find_Path_Index(pvs, VAL_OBJ_FRAME(pvs->value));
 	}
 //	else if (IS_INTEGER(pvs->select)) {
 //		n = Int32s(pvs->select, 1);
@@ -294,9 +296,11 @@ static REBSER *Trim_Object(REBSER *obj)
 
 				// make object! [init]
 				if (type == REB_OBJECT) {
-					obj = Make_Object(0, VAL_BLK_DATA(arg));
+					UNCOMPILE_BLOCK(VAL_SERIES(arg));
+					REMEMBER_SERIES(VAL_SERIES(arg));
+					obj = Make_Bound_Object(0, VAL_BLK_DATA(arg), BIND_DEEP, FALSE);
 					SET_OBJECT(ds, obj); // GC save
-					arg = Do_Bind_Block(obj, arg); // GC-OK
+					arg = DO_BLK(arg); // GC-OK
 					if (THROWN(arg)) {
 						DS_RET_VALUE(arg);
 						return R_RET;
@@ -361,17 +365,19 @@ static REBSER *Trim_Object(REBSER *obj)
 
 			// make parent none | []
 			if (IS_NONE(arg) || (IS_BLOCK(arg) && IS_EMPTY(arg))) {
-				obj = Copy_Block_Values(src_obj, 0, SERIES_TAIL(src_obj), TS_CLONE);
+				obj = Make_Object(src_obj, 0, TRUE);
 				Rebind_Frame(src_obj, obj);
 				break;	// returns obj
 			}
 
 			// make parent [...]
 			if (IS_BLOCK(arg)) {
-				obj = Make_Object(src_obj, VAL_BLK_DATA(arg));
+				UNCOMPILE_BLOCK(VAL_SERIES(arg));
+				REMEMBER_SERIES(VAL_SERIES(arg));
+				obj = Make_Bound_Object(src_obj, VAL_BLK_DATA(arg), BIND_DEEP, TRUE);
 				Rebind_Frame(src_obj, obj);
 				SET_OBJECT(ds, obj);
-				arg = Do_Bind_Block(obj, arg); // GC-OK
+				arg = DO_BLK(arg); // GC-OK
 				if (THROWN(arg)) {
 					DS_RET_VALUE(arg);
 					return R_RET;
@@ -74,7 +74,7 @@
 
 			spec = Get_System(SYS_STANDARD, STD_UTYPE);
 			if (!IS_OBJECT(spec)) Trap_Arg(spec);
-			SET_UTYPE(D_RET, Make_Object(VAL_OBJ_FRAME(spec), body));
+			SET_UTYPE(D_RET, Make_Object(VAL_OBJ_FRAME(spec), body, FALSE));
 			VAL_UTYPE_DATA(D_RET) = 0;
 			return R_RET;
 		}
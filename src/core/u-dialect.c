@@ -461,6 +461,7 @@ again:
 	dia.args = block;
 	dia.argi = *index;
 	dia.out  = *out;	
+	REMEMBER_SERIES(dia.out);
 	SET_FLAG(dia.flags, RDIA_NO_CMD);
 
 	//Print("DSP: %d Dinp: %r - %m", DSP, BLK_SKIP(block, *index), block);
@@ -500,6 +501,8 @@ again:
 	dia.argi = VAL_INDEX(D_ARG(2));
 	dia.out = VAL_SERIES(D_ARG(3));	
 	dia.outi = VAL_INDEX(D_ARG(3));
+	UNCOMPILE_BLOCK(dia.out);
+	REMEMBER_SERIES(dia.out);
 
 	if (dia.argi >= SERIES_TAIL(dia.args)) return R_NONE; // end of block
 
@@ -242,6 +242,36 @@ typedef void(*CFUNC)(void *);
 #define COPY_MEM(t,f,l) memcpy((void*)(t), (void*)(f), l)
 #define MOVE_MEM(t,f,l) memmove((void*)(t), (void*)(f), l)
 
+// Memory order, for data read by other threads without a lock. A
+// value is written, then RELEASE_FENCE, then what refers to it. The
+// reader reads the reference, then ACQUIRE_FENCE, then the value.
+// A reference shared so must be read and written with LOAD_ONCE and
+// STORE_ONCE (t is its type), so it is done once and whole.
+// SWAP_IF atomically sets v to n if it is o (and says if it did).
+#ifdef _MSC_VER
+#include <intrin.h>
+#if defined(_M_IX86) || defined(_M_X64)
+// (x86 does not reorder loads, nor stores, so only the compiler must be held)
+#define ACQUIRE_FENCE()     _ReadWriteBarrier()
+#define RELEASE_FENCE()     _ReadWriteBarrier()
+#elif defined(_M_ARM64)
+#define ACQUIRE_FENCE()     __dmb(_ARM64_BARRIER_ISH)
+#define RELEASE_FENCE()     __dmb(_ARM64_BARRIER_ISH)
+#else
+#define ACQUIRE_FENCE()     __dmb(_ARM_BARRIER_ISH)
+#define RELEASE_FENCE()     __dmb(_ARM_BARRIER_ISH)
+#endif
+#define LOAD_ONCE(t,v)      (*(t volatile *)&(v))
+#define STORE_ONCE(t,v,n)   (*(t volatile *)&(v) = (n))
+#define SWAP_IF(v,o,n)      (_InterlockedCompareExchange((long volatile *)&(v), (n), (o)) == (long)(o))
+#else
+#define ACQUIRE_FENCE()     __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define RELEASE_FENCE()     __atomic_thread_fence(__ATOMIC_RELEASE)
+#define LOAD_ONCE(t,v)      ((t)__atomic_load_n(&(v), __ATOMIC_RELAXED))
+#define STORE_ONCE(t,v,n)   __atomic_store_n(&(v), (t)(n), __ATOMIC_RELAXED)
+#define SWAP_IF(v,o,n)      __sync_bool_compare_and_swap(&(v), (o), (n))
+#endif
+
 // Byte string functions:
 #define COPY_BYTES(t,f,l)   strncpy((char*)t, (char*)f, l)
 // For APPEND_BYTES, l is the max-size allocated for t (dest)
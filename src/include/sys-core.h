@@ -37,6 +37,7 @@
 //#define DEBUGGING				// debug output and debugger assistance
 //#define SERIES_LABELS			// enable identifier labels for series
 //#define MUNGWALL				// memory allocation bounds checking
+//#define GC_VERIFY				// check the write barrier at each minor recycle
 #define STACK_MIN   4000		// data stack increment size
 #define STACK_LIMIT 400000		// data stack max (6.4MB)
 #define MIN_COMMON 10000		// min size of common buffer
@@ -44,6 +45,7 @@
 #define	MAX_NUM_LEN 64			// As many numeric digits we will accept on input
 #define MAX_SAFE_SERIES 5		// quanitity of most recent series to not GC.
 #define MAX_EXPAND_LIST 5		// number of series-1 in Prior_Expand list
+#define EXPAND_LARGE (4 * MEM_BIG_SIZE)	// series bytes that grow by half (not from a pool)
 #define USE_UNICODE 1			// scanner uses unicode
 #define UNICODE_CASES 0x2E00	// size of unicode folding table
 #define HAS_SHA1				// allow it
@@ -252,6 +254,13 @@ enum rebol_signals {
 	SIG_EVENT_PORT,
 };
 
+// Incremental recycle phases (see m-gc.c):
+enum {
+	GC_IDLE = 0,
+	GC_MARKING,		// scanning gray blocks in slices
+	GC_SWEEPING,	// freeing series a segment at a time
+};
+
 // Security flags:
 enum {
 	SEC_ALLOW,
@@ -327,6 +336,10 @@ enum encoding_opts {
 #define REM2(a, b) ((b)!=-1 ? (a) % (b) : 0)
 //#define DO_BLOCK(v) Do_Block(VAL_SERIES(v), VAL_INDEX(v))
 #define DO_BLK(v) Do_Blk(VAL_SERIES(v), VAL_INDEX(v))
+// For a native that returns the result of the block (see Do_Tail_Blk):
+#define DO_TAIL_BLK(v) ((DSF_ACTIVE(DSF) == DSF_TAIL) ? Do_Tail_Blk(VAL_SERIES(v), VAL_INDEX(v)) : DO_BLK(v))
+// For a native that keeps values of a shared body block (see Shared_Args):
+#define UNSHARE(v) {if (VAL_GET_OPT(v, OPTS_SHARE) || (ANY_WORD(v) && VAL_WORD_INDEX(v) < 0)) Unshare_Value(v);}
 
 #define DEAD_END	return 0	// makes compiler happy (for never used return case)
 
@@ -384,7 +397,7 @@ enum encoding_opts {
 typedef struct rebol_word_table
 {
 	REBSER	*series;	// Global block of words
-	REBSER	*hashes;	// Hash table
+	struct Reb_Word_Hash *hashes;	// Hash table (see c-word.c)
 //	REBCNT	count;		// Number of units used in hash table
 } WORD_TABLE;
 
@@ -402,6 +415,8 @@ typedef struct rebol_stats {
 	REBCNT	Free_List_Checked;
 	REBCNT	Blocks;
 	REBCNT	Objects;
+	REBCNT	Segs_Released;
+	REBI64	Bytes_Released;
 } REB_STATS;
 
 //-- Options of various kinds:
@@ -62,6 +62,8 @@ PVAR REB_OPTS *Reb_Opts;
 // when implemented that way. Needs research!!!!
 PVAR REBCNT	Eval_Signals;	// Signal flags
 
+PVAR REBCNT	Op_Epoch;		// Changes when an op! is stored in a variable
+
 
 
 /***********************************************************************
@@ -83,6 +85,16 @@ TVAR REBSER	*GC_Series;		// An array of protected series (removed by address)
 TVAR REBSER	**GC_Infants;	// A small list of last N series created (nursery)
 TVAR REBINT	GC_Last_Infant;	// Index to last infant above (circular)
 TVAR REBFLG GC_Stay_Dirty;  // Do not free memory, fill it with 0xBB
+TVAR REBFLG	GC_Generational; // Auto-recycle only new series (see m-gc.c)
+TVAR REBFLG	GC_Minor;		// The current recycle is of new series only
+TVAR REBCNT	GC_Minors;		// Minor recycles since the last full one
+TVAR REBSER	*GC_Frames;		// Frames found by recycles (scanned by minor ones)
+TVAR REBSER	*GC_Remembered;	// Old blocks written since the last recycle
+TVAR REBCNT	GC_Slice;		// Incremental recycle work per slice (or zero)
+TVAR REBCNT	GC_Workers;		// Threads to sweep with (zero or one: none)
+TVAR REBCNT	GC_Phase;		// Incremental recycle in progress (GC_MARKING...)
+TVAR REBSER	*GC_Gray;		// Blocks marked but not yet scanned
+TVAR REBSEG	*GC_Sweep_Seg;	// Next series segment to sweep
 TVAR REBSER **Prior_Expand;	// Track prior series expansions (acceleration)
 
 TVAR REBUPT Stack_Limit;	// Limit address for CPU stack.
@@ -101,6 +113,7 @@ TVAR REBI64	Eval_Limit;		// Evaluation limit (set by secure)
 TVAR REBINT	Eval_Count;		// Evaluation counter (downward)
 TVAR REBINT	Eval_Dose;		// Evaluation counter reset value
 TVAR REBCNT	Eval_Sigmask;	// Masking out signal flags
+TVAR REBFLG	Eval_Tail;		// Next Do_Next is an expression in tail position
 
 TVAR REBCNT	Trace_Flags;	// Trace flag
 TVAR REBINT	Trace_Level;	// Trace depth desired
@@ -108,8 +121,18 @@ TVAR REBINT Trace_Depth;	// Tracks trace indentation
 TVAR REBCNT Trace_Limit;	// Backtrace buffering limit
 TVAR REBSER *Trace_Buffer;	// Holds backtrace lines
 
+TVAR REBSER *Prof_Stacks;	// Stacks sampled by PROFILE (see d-profile.c)
+TVAR REBSER *Prof_Hash;		// Hash table of the stacks
+TVAR REBCNT Prof_Entries;	// Number of distinct stacks
+TVAR REBINT Prof_Base;		// DSF of the PROFILE native
+TVAR REBSER *Prof_Sites;	// Where series are made, for PROFILE/memory
+TVAR REBSER *Prof_Site_Hash;	// Hash table of the sites
+TVAR REBCNT Prof_Site_Base;	// Sites of outer profiles are numbered below
+
 TVAR REBI64 Eval_Natives;
 TVAR REBI64 Eval_Functions;
 
 //-- Other per thread globals:
 TVAR REBSER *Bind_Table;	// Used to quickly bind words to contexts
+TVAR REBCNT Bind_Mark;		// Entries of the current bind have this mark
+TVAR REBCNT Bind_Count;		// Number of them
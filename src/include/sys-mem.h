@@ -76,6 +76,9 @@ typedef void *REBNOD;			// Just used for linking free nodes
 	REBSEG	*segs;				// first memory segment
 	REBNOD	*first;				// first free node in pool
 	REBCNT	has;				// total number of units
+	REBCNT	trim;				// units free after last trimmed
+	REBYTE	*fresh;				// next unused node of newest segment
+	REBCNT	left;				// unused nodes left in it
 //	UL		total;				// total bytes for all segs
 //	char	*name;				// identifying string
 //	UL		extra;				// reserved
@@ -103,6 +106,7 @@ typedef void *REBNOD;			// Just used for linking free nodes
 
 #define	MEM_MIN_SIZE sizeof(REBVAL)
 #define MEM_BIG_SIZE 1024
+#define MEM_MAP_SIZE (4 * 1024 * 1024) // series data mapped from the OS (see OS_Map_Mem)
 
 #define MEM_BALLAST 3000000
 
@@ -77,6 +77,7 @@ enum reb_panics {
 	RP_MAX_SCHEMES,			// Too many native schemes
 	RP_BIND_BOUNDS,			// Bind is out of bounds for the frame
 	RP_SERIES_OVERFLOW,		// Tail has gone past end of series
+	RP_MISSED_BARRIER,		// Minor GC did not mark a live series (see GC_VERIFY)
 
 //  Datatype Errors (300 + N --indicates location)
 	RP_DATATYPE = 1300,
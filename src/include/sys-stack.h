@@ -79,6 +79,19 @@
 #define DSF_ARGS(d,n)	(&DS_Base[(d)+DSF_SIZE+(n)])
 #define PRIOR_DSF(d)	VAL_BACK(DSF_BACK(d))
 
+// The frame of the running body of a FUNCTION! or CLOSURE! is kept in the
+// zeroth word of its args (see REBAHD), so its relative words are
+// found without a stack walk. The frame saves the prior one:
+#define FUNC_ACTIVE(a)	(BLK_HEAD(a)->data.arghead.active)
+#define DSF_ACTIVE(d)	VAL_WORD_INDEX(DSF_WORD(d))	// -1 if not running a body
+#define DSF_TAIL		(-2)	// DSF_ACTIVE of a native called in tail position
+#define IS_ACTIVE_DSF(d, f) ((d) > 0 && (d) <= DSF && DSF_ACTIVE(d) >= 0 && VAL_WORD_FRAME(DSF_WORD(d)) == (f))
+// A CLOSURE! keeps the values of its running body in a frame object.
+// The relative words after the args of a method are its object fields:
+#define DSF_VAR(d,n)	(IS_CLOSURE(DSF_FUNC(d)) ? BLK_SKIP(VAL_SERIES(DSF_RETURN(d)), n) \
+						: (REBCNT)(n) < VAL_FUNC_ARGC(DSF_FUNC(d)) ? DSF_ARGS(d,n) \
+						: FRM_VALUES(VAL_METHOD_SELF(DSF_FUNC(d))) + (n) - VAL_FUNC_ARGC(DSF_FUNC(d)))
+
 // Reference from ds that points to current return value:
 #define	D_RET			(ds)
 #define D_ARG(n)		(ds+(DSF_SIZE+n))
@@ -48,6 +48,7 @@ typedef struct {		// State variables to save
 
 #define POP_STATE(s, g) do {\
 		g = (s).last_jmp_buf;\
+		Drop_Active_Frames((s).dsf);\
 		DSP = (s).dsp;\
 		DSF = (s).dsf;\
 		GC_Protect->tail = (s).hold_tail;\
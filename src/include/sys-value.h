@@ -76,6 +76,7 @@ enum {
 	OPTS_UNWORD,	// Not a normal word
 	OPTS_TEMP,		// Temporary flag - variety of uses
 	OPTS_HIDE,		// Hide the word
+	OPTS_SHARE,		// Shared closure or method body value, or arg that takes one (see Do_Closure)
 };
 
 #define VAL_OPTS(v)			((v)->flags.flags.opts)
@@ -320,12 +321,10 @@ typedef struct Reb_Tuple {
 	REBCNT	tail;		// one past end of useful data
 	REBCNT	rest;		// total number of units from bias to end
 	REBINT	info;		// holds width and flags
-#if defined(__LP64__) || defined(__LLP64__)
-	REBCNT	padding;	// ensure next pointer is naturally aligned
-#endif
+	REBCNT	gen;		// GC generation (also aligns next pointer)
 	union {
 		REBCNT size;	// used for vectors and bitsets
-		REBSER *series;	// MAP datatype uses this
+		REBSER *series;	// MAP hash, or block code cells
 		struct {
 			REBCNT wide:16;
 			REBCNT high:16;
@@ -427,6 +426,25 @@ enum {
 
 #define TRAP_PROTECT(s) if (IS_PROTECT_SERIES(s)) Trap0(RE_PROTECTED)
 
+// Series generation, for minor recycles (see m-gc.c):
+enum {
+	GEN_OLD   = 1,		// Series survived a collection
+	GEN_DIRTY = 1<<1,	// Block was written since the last collection
+	GEN_FRAME = 1<<2,	// Block is an object frame (always scanned)
+	GEN_GRAY  = 1<<3,	// Block is to be scanned (incremental recycle)
+	GEN_SWEEP = 1<<4,	// Series was made while sweeping (keep it)
+};
+
+// Higher bits: where the series was made (see PROFILE/memory):
+#define GEN_SITE(s)        ((s)->gen >> 8)
+#define SET_GEN_SITE(s,n)  ((s)->gen = ((s)->gen & 0xff) | ((n) << 8))
+
+#define IS_OLD_SERIES(s)   ((s)->gen & GEN_OLD)
+// Write barrier: must be used when a value is stored into a block
+// that may be old (frames and the stack are always scanned):
+#define REMEMBER_SERIES(s) \
+	if (((s)->gen & (GEN_OLD|GEN_DIRTY|GEN_FRAME)) == GEN_OLD) Remember_Series(s)
+
 #ifdef SERIES_LABELS
 #define LABEL_SERIES(s,l) s->label = (l)
 #else
@@ -693,6 +711,157 @@ typedef struct Reb_Side {		// lookaside series
 #define	SET_LIST(v,s,l)	VAL_SERIES(v)=(s), VAL_INDEX(v)=0, VAL_SER_LIST(v)=(l), VAL_SET(v, REB_LIST)
 
 
+/***********************************************************************
+**
+**	BLOCK CODE -- Pre-decoded evaluation cells for a block
+**
+**		A block that is evaluated many times (a function body) can
+**		keep a side series of code cells, one per value, in the
+**		series field of its header. See Compile_Block().
+**
+***********************************************************************/
+
+typedef struct Reb_Code_Cell {
+	REBSER	*args;		// args of the function last called from here
+	REBCNT	argc;		// its count of plain word args (or NO_PLAN)
+	REBCNT	kind;		// CODE_ flags
+#if !defined(__LP64__) && !defined(__LLP64__)
+	REBCNT	padding;	// keep the width a divisor of the pool sizes
+#endif
+} REBCOD;
+
+enum {
+	CODE_INERT = 1,		// value evaluates to itself
+	CODE_WORD  = 1<<1,	// word (a variable or a call site)
+	CODE_LAST  = 1<<2,	// next value is not a word (no infix op follows)
+	CODE_NOT_OP = 1<<3,	// word was not an op (valid while size == Op_Epoch)
+};
+
+#define NO_PLAN		((REBCNT)(~0))	// args must go thru Do_Args
+#define CODE_DEPTH	8	// nested blocks compiled with a function body
+
+#define IS_CODE_SERIES(c)	((c) && SERIES_WIDE(c) == sizeof(REBCOD))
+#define CODE_SKIP(c, n)		(((REBCOD *)((c)->data))+(n))
+// Code cells of a block, if any and still matching its length:
+#define BLK_CODE(b)			((IS_CODE_SERIES((b)->series) && SERIES_TAIL((b)->series) == SERIES_TAIL(b)) ? (b)->series : 0)
+#define UNCOMPILE_BLOCK(b)	if (IS_CODE_SERIES((b)->series)) (b)->series = 0
+// Storing an op! into a variable voids all CODE_NOT_OP cells:
+#define NOTE_OP_SET(v)		if (IS_OP(v)) Op_Epoch++
+
+
+/***********************************************************************
+**
+**	PATH CACHE -- Object fields last found by a path
+**
+**		A path that selects fields of objects keeps a side series in
+**		the series field of its header, one entry per value of the
+**		path, with the word lists of the objects last seen there and
+**		the index of the field in each. See Find_Path_Index().
+**
+***********************************************************************/
+
+#define PATH_WAYS	3	// word lists kept per entry (most recent first)
+
+typedef struct Reb_Path_Cache {
+	REBSER	*words[PATH_WAYS];	// word list of an object frame
+	REBUPT	index[PATH_WAYS];	// index of the field in it
+} REBPIC;
+
+// Kinds of side series, kept in their own (otherwise unused) size
+// field. A width can be shared: on 32-bit builds a path cache is as
+// wide as the hashes of a MAP block, which leave it zero.
+enum {
+	SIDE_PATH = 1,		// path cache
+	SIDE_PLAN,			// arg plan of a function's word list
+	SIDE_WORDS,			// word hash of a frame's word list
+};
+#define SIDE_KIND(s)		((s)->size)
+
+// The series is of REBUPT units (a width that fits all memory pools
+// and differs from that of a block or code cells):
+#define PIC_UNITS			(sizeof(REBPIC) / sizeof(REBUPT))
+#define IS_PATH_CACHE(c)	((c) && SERIES_WIDE(c) == sizeof(REBUPT) && SIDE_KIND(c) == SIDE_PATH)
+#define PATH_CACHE_LEN(c)	(SERIES_TAIL(c) / PIC_UNITS)
+#define PATH_CACHE_SKIP(c, n) (((REBPIC *)((c)->data))+(n))
+
+
+/***********************************************************************
+**
+**	ARG PLAN -- How Do_Args gathers the args of a function
+**
+**		The word list (args) of a function keeps a side series in
+**		its header, made when the function is first called, of
+**		REBCNT units: a header, one kind per arg word, and the
+**		canon symbol and arg index of each refinement. See
+**		Make_Arg_Plan().
+**
+***********************************************************************/
+
+enum {
+	PLAN_LEN,		// length of the word list the plan is for
+	PLAN_ARGC,		// plain word args before a refinement or end (or NO_PLAN)
+	PLAN_REFS,		// number of refinements
+	PLAN_HEAD		// arg kinds follow (for arg 1 and up)
+};
+
+enum {
+	ARG_EVAL = 1,	// WORD - evaluate next value
+	ARG_QUOTE,		// 'WORD - just get next value
+	ARG_GET,		// :WORD - get next value
+	ARG_REFINE,		// /WORD - function refinement
+	ARG_KIND = 7,	// (mask of the above)
+	ARG_TYPED = 8,	// typeset does not allow all types (must check)
+};
+
+#define IS_ARG_PLAN(p, w)	((p) && SERIES_WIDE(p) == sizeof(REBCNT) && SIDE_KIND(p) == SIDE_PLAN && PLAN_VALUE(p, PLAN_LEN) == SERIES_TAIL(w))
+#define PLAN_VALUE(p, n)	(((REBCNT *)((p)->data))[n])
+#define PLAN_KINDS(p)		(((REBCNT *)((p)->data)) + PLAN_HEAD - 1) // indexed by arg
+#define PLAN_REFINES(p)		(((REBCNT *)((p)->data)) + PLAN_HEAD - 1 + PLAN_VALUE(p, PLAN_LEN))
+// Plan of the args of a function:
+#define ARG_PLAN(w)			(IS_ARG_PLAN((w)->series, w) ? (w)->series : Make_Arg_Plan(w))
+
+
+/***********************************************************************
+**
+**	WORD HASH -- Index of the words of a large frame
+**
+**		The word list of a frame of more than WORD_HASH_MIN words
+**		keeps a side series in its header, of REBCNT pairs: its size
+**		and the count of words it holds, then an open addressed table
+**		of the canon symbol and index of each word (index zero for an
+**		empty slot). See Find_Word_Index().
+**
+***********************************************************************/
+
+#define WORD_HASH_MIN		32	// smaller frames are just searched
+#define WORD_HASH_MUL		2654435761u	// (odd, so spreads sequential symbols)
+#define IS_WORD_HASH(h)		((h) && SERIES_WIDE(h) == 2 * sizeof(REBCNT) && SIDE_KIND(h) == SIDE_WORDS)
+#define WORD_HASH_SIZE(h)	(((REBCNT *)((h)->data))[0])	// slots, a power of two
+#define WORD_HASH_COUNT(h)	(((REBCNT *)((h)->data))[1])	// words of the list held
+#define WORD_HASH_SLOTS(h)	(((REBCNT *)((h)->data)) + 2)	// canon, index pairs
+
+
+/***********************************************************************
+**
+**	BIND TABLE -- Frame index of each word, during a bind
+**
+**		Each task has a small open addressed table of the canon
+**		symbol and index of the words of the bind in progress, keyed
+**		as the WORD HASH. An entry counts only if it has the current
+**		Bind_Mark, so a new bind just changes the mark (see c-frame.c).
+**
+***********************************************************************/
+
+typedef struct Reb_Bind {
+	REBCNT	canon;
+	REBINT	index;	// (zero if not in the frame)
+	REBCNT	mark;	// entry of the current bind if Bind_Mark
+} REBBND;
+
+#define BIND_TABLE_SIZE		256	// slots to start, a power of two
+#define BIND_SLOTS(t)		((REBBND *)((t)->data))
+
+
 /***********************************************************************
 **
 **	SYMBOLS -- Used only for symbol tables
@@ -736,6 +905,13 @@ typedef struct Reb_Word_Spec {
 	REBU64	typeset;
 } REBWRS;
 
+// The zeroth word of the args of a function is not a word spec:
+typedef struct Reb_Args_Head {
+	REBCNT	sym;
+	REBINT	active;		// Frame of the running body (see FUNC_ACTIVE), -1 if never run
+	REBSER	*spec;		// Spec of a method (see Make_Method)
+} REBAHD;
+
 #define IS_SAME_WORD(v, n)		(IS_WORD(v) && VAL_WORD_CANON(v) == n)
 
 #define VAL_WORD_SYM(v)			((v)->data.word.sym)
@@ -779,10 +955,6 @@ typedef struct Reb_Frame {
 #define	VAL_FRM_SPEC(v)		((v)->data.frame.spec)
 //#define	VAL_FRM_PARENT(v)	((v)->data.frame.parent)
 
-// Word number array (used by Bind_Table):
-#define WORDS_HEAD(w)		((REBINT *)(w)->data)
-#define WORDS_LAST(w)		(((REBINT *)(w)->data)+(w)->tail-1) // (tail never zero)
-
 // Frame series to frame components:
 #define FRM_WORD_SERIES(c)	VAL_FRM_WORDS(BLK_HEAD(c))
 #define FRM_WORDS(c)		BLK_HEAD(FRM_WORD_SERIES(c))
@@ -938,6 +1110,13 @@ typedef struct Reb_Function {
 #define VAL_FUNC_ACT(v)       ((v)->data.func.func.act)
 #define VAL_FUNC_ARGC(v)	  SERIES_TAIL((v)->data.func.args)
 
+// A method is a function shared by the objects made from a prototype.
+// It holds its object in place of the spec, which its args keep:
+#define IS_METHOD(v)		  (IS_FUNCTION(v) && IS_FRAME(BLK_HEAD(VAL_FUNC_SPEC(v))))
+#define VAL_METHOD_SELF(v)	  VAL_FUNC_SPEC(v)
+#define ARGS_SPEC(a)		  (BLK_HEAD(a)->data.arghead.spec)
+#define VAL_FUNC_SPEC_OF(v)	  (IS_METHOD(v) ? ARGS_SPEC(VAL_FUNC_ARGS(v)) : VAL_FUNC_SPEC(v))
+
 typedef struct Reb_Path_Value {
 	REBVAL *value;	// modified
 	REBVAL *select;	// modified
@@ -1103,6 +1282,7 @@ typedef struct Reb_All {
 		REBTYP	datatype;
 		REBFRM	frame;
 		REBWRS	wordspec;
+		REBAHD	arghead;
 		REBTYS  typeset;
 		REBSYM	symbol;
 		REBTIM	time;
@@ -57,6 +57,14 @@ has: func [
 	make function! reduce [head insert copy/deep vars /local copy/deep body]
 ]
 
+rebcode: func [
+	{Defines a rebcode (virtual machine) function. Locals are its registers.}
+	spec [block!] {Help string (opt) followed by arg words (and opt type and string)}
+	body [block!] {The rebcode instructions}
+][
+	make rebcode! copy/deep reduce [spec body]
+]
+
 context: func [
 	{Defines a unique object.}
 	blk [block!] {Object words and values (modified)}
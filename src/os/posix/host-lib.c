@@ -50,6 +50,10 @@
 **     Do not even modify the argument names.
 */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // for mremap
+#endif
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
@@ -57,6 +61,16 @@
 #include <sys/wait.h>
 #include <time.h>
 #include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifndef MAP_ANONYMOUS // for older systems
+#define MAP_ANONYMOUS MAP_ANON
+#endif
 
 #ifndef timeval // for older systems
 #include <sys/time.h>
@@ -180,6 +194,76 @@ static void *Task_Ready;
 }
 
 
+/***********************************************************************
+**
+*/	void OS_Trim_Mem(void)
+/*
+**		Return freed memory to the OS, if the C library keeps it
+**		(as glibc does for its heap). Called after the memory pools
+**		free their empty segments.
+**
+***********************************************************************/
+{
+#ifdef __GLIBC__
+	malloc_trim(0);
+#endif
+}
+
+
+/***********************************************************************
+**
+*/	void *OS_Map_Mem(size_t size)
+/*
+**		Allocate a very large block of memory (for series data)
+**		directly from the OS, as anonymous pages. Where it is
+**		supported, they are marked to use transparent huge pages,
+**		for fewer TLB misses when scanning the data.
+**
+**		The memory is clear. Returns zero if it cannot be mapped.
+**
+***********************************************************************/
+{
+	void *mem = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (mem == MAP_FAILED) return 0;
+#ifdef MADV_HUGEPAGE
+	madvise(mem, size, MADV_HUGEPAGE);
+#endif
+	return mem;
+}
+
+
+/***********************************************************************
+**
+*/	void *OS_Remap_Mem(void *mem, size_t size, size_t new_size)
+/*
+**		Change the size of memory from OS_Map_Mem, keeping what it
+**		holds. The pages are moved, not copied. Returns zero if it
+**		cannot be done (the memory is unchanged).
+**
+***********************************************************************/
+{
+#ifdef MREMAP_MAYMOVE
+	mem = mremap(mem, size, new_size, MREMAP_MAYMOVE);
+	return (mem == MAP_FAILED) ? 0 : mem;
+#else
+	return 0;
+#endif
+}
+
+
+/***********************************************************************
+**
+*/	void OS_Unmap_Mem(void *mem, size_t size)
+/*
+**		Give memory from OS_Map_Mem back to the OS.
+**
+***********************************************************************/
+{
+	munmap(mem, size);
+}
+
+
 /***********************************************************************
 **
 */	void OS_Exit(int code)
@@ -583,6 +667,63 @@ static void *Task_Ready;
 }
 
 
+// A function call to be made on a thread of its own:
+typedef struct {
+	CFUNC func;
+	void *arg;
+} THREAD_CALL;
+
+static void *Call_Thread(void *call)
+{
+	((THREAD_CALL *)call)->func(((THREAD_CALL *)call)->arg);
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	void OS_Run_Threads(CFUNC func, void **args, REBINT count)
+/*
+**		Call the function with each of the args, all at once on
+**		threads of their own, and wait for them to finish. The
+**		last is called on this thread, as are any for which a
+**		thread cannot be made.
+**
+**		The function must not call back into REBOL.
+**
+***********************************************************************/
+{
+	pthread_t *threads;
+	THREAD_CALL *calls;
+	REBINT n;
+
+	if (count <= 0) return;
+
+	threads = malloc(count * sizeof(pthread_t));
+	calls = malloc(count * sizeof(THREAD_CALL));
+
+	for (n = 0; n < count - 1; n++) {
+		if (threads && calls) {
+			calls[n].func = func;
+			calls[n].arg = args[n];
+			if (!pthread_create(&threads[n], 0, Call_Thread, &calls[n])) continue;
+			calls[n].func = 0;
+		}
+		func(args[n]);
+	}
+
+	func(args[count - 1]);
+
+	if (threads && calls) {
+		for (n = 0; n < count - 1; n++)
+			if (calls[n].func) pthread_join(threads[n], 0);
+	}
+
+	free(threads);
+	free(calls);
+}
+
+
 /***********************************************************************
 **
 */	int OS_Create_Process(REBCHR *call, u32 flags)
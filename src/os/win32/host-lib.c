@@ -174,6 +174,64 @@ static void *Task_Ready;
 }
 
 
+/***********************************************************************
+**
+*/	void OS_Trim_Mem(void)
+/*
+**		Return freed memory to the OS, if the C library keeps it
+**		(as glibc does for its heap). Called after the memory pools
+**		free their empty segments.
+**
+***********************************************************************/
+{
+	HeapCompact(GetProcessHeap(), 0);
+}
+
+
+/***********************************************************************
+**
+*/	void *OS_Map_Mem(size_t size)
+/*
+**		Allocate a very large block of memory (for series data)
+**		directly from the OS, as anonymous pages. Where it is
+**		supported, they are marked to use transparent huge pages,
+**		for fewer TLB misses when scanning the data.
+**
+**		The memory is clear. Returns zero if it cannot be mapped.
+**
+***********************************************************************/
+{
+	// (Large pages need a user privilege on Windows, so not used.)
+	return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+
+/***********************************************************************
+**
+*/	void *OS_Remap_Mem(void *mem, size_t size, size_t new_size)
+/*
+**		Change the size of memory from OS_Map_Mem, keeping what it
+**		holds. The pages are moved, not copied. Returns zero if it
+**		cannot be done (the memory is unchanged).
+**
+***********************************************************************/
+{
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	void OS_Unmap_Mem(void *mem, size_t size)
+/*
+**		Give memory from OS_Map_Mem back to the OS.
+**
+***********************************************************************/
+{
+	VirtualFree(mem, 0, MEM_RELEASE);
+}
+
+
 /***********************************************************************
 **
 */	void OS_Exit(int code)
@@ -561,6 +619,66 @@ static void *Task_Ready;
 }
 
 
+// A function call to be made on a thread of its own:
+typedef struct {
+	CFUNC func;
+	void *arg;
+} THREAD_CALL;
+
+static unsigned __stdcall Call_Thread(void *call)
+{
+	((THREAD_CALL *)call)->func(((THREAD_CALL *)call)->arg);
+	return 0;
+}
+
+
+/***********************************************************************
+**
+*/	void OS_Run_Threads(CFUNC func, void **args, REBINT count)
+/*
+**		Call the function with each of the args, all at once on
+**		threads of their own, and wait for them to finish. The
+**		last is called on this thread, as are any for which a
+**		thread cannot be made.
+**
+**		The function must not call back into REBOL.
+**
+***********************************************************************/
+{
+	HANDLE *threads;
+	THREAD_CALL *calls;
+	REBINT n;
+
+	if (count <= 0) return;
+
+	threads = malloc(count * sizeof(HANDLE));
+	calls = malloc(count * sizeof(THREAD_CALL));
+
+	for (n = 0; n < count - 1; n++) {
+		if (threads && calls) {
+			calls[n].func = func;
+			calls[n].arg = args[n];
+			threads[n] = (HANDLE)_beginthreadex(NULL, 0, Call_Thread, &calls[n], 0, NULL);
+			if (threads[n]) continue;
+		}
+		func(args[n]);
+	}
+
+	func(args[count - 1]);
+
+	if (threads && calls) {
+		for (n = 0; n < count - 1; n++) {
+			if (!threads[n]) continue;
+			WaitForSingleObject(threads[n], INFINITE);
+			CloseHandle(threads[n]);
+		}
+	}
+
+	free(threads);
+	free(calls);
+}
+
+
 /***********************************************************************
 **
 */	int OS_Create_Process(REBCHR *call, u32 flags)
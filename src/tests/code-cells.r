@@ -0,0 +1,77 @@
+REBOL [
+	System: "REBOL [R3] Language Interpreter and Run-time Environment"
+	Title: "Code cell regression checks"
+	Rights: {
+		Copyright 2012 REBOL Technologies
+		REBOL is a trademark of REBOL Technologies
+	}
+	License: {
+		Licensed under the Apache License, Version 2.0
+		See: http://www.apache.org/licenses/LICENSE-2.0
+	}
+	Purpose: {
+		Changes a function body (or a block in it) after it has run,
+		so it has code cells (see Compile_Block in c-do.c), and checks
+		that it is then evaluated as changed. Prints the failures.
+	}
+	Usage: {r3 code-cells.r}
+]
+
+fails: 0
+check: func [name result expect] [
+	if result <> expect [
+		print ["FAIL:" name "got" mold result "expected" mold expect]
+		fails: fails + 1
+	]
+]
+
+foo: 'evaluated
+x: 0
+
+; Runs a body that refers to the block (it needs a word to be
+; compiled), so that the block has code cells:
+make-test: func [body] [
+	f: func [] compose/only [b: (body) do b]
+	loop 3 [f]
+	b
+]
+
+b: make-test [x 10]
+parse b [word! change integer! 'foo]
+check "parse change to a word" f 'evaluated
+
+b: make-test [x 1 2 3]
+parse b [word! integer! change integer! '+]
+check "parse change to an infix op" f 4
+
+b: make-test [x 1 2]
+parse b [word! integer! insert '+]
+check "parse insert of an infix op" f 3
+
+b: make-test [x 1 2 3]
+parse b [word! integer! remove integer! insert '*]
+check "parse remove and insert" f 3
+
+b: make-test [x 1 2 5]
+poker: rebcode [b v] [poke b 3 v return b]
+poker b '+
+check "rebcode poke" f 6
+
+b: make-test [x 1 2 5]
+b/3: '+
+check "path set" f 6
+
+; An op! stored into a variable not by a set-word must void the
+; cached lookahead of the cells (see NOTE_OP_SET):
+o: object [f: none]
+fn: func [] bind [1 f 2] o
+loop 3 [fn]
+set o reduce [:+]
+check "set of an op into an object" fn 3
+
+g: none
+foreach f reduce [:negate :+] [if none? :g [g: does [1 f 2]] r: g]
+check "foreach of an op" r 3
+
+print either zero? fails ["Code cells: all passed"] [join "Code cells failed: " fails]
+quit/return fails
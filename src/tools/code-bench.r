@@ -0,0 +1,43 @@
+REBOL [
+	System: "REBOL [R3] Language Interpreter and Run-time Environment"
+	Title: "Function body benchmark"
+	Rights: {
+		Copyright 2012 REBOL Technologies
+		REBOL is a trademark of REBOL Technologies
+	}
+	License: {
+		Licensed under the Apache License, Version 2.0
+		See: http://www.apache.org/licenses/LICENSE-2.0
+	}
+	Purpose: {
+		Times function bodies that run many times, to measure their
+		code cells (see Compile_Block in c-do.c): calls of a function
+		with args, reads of words and inert values, and infix ops.
+		Run it with each build to compare them.
+	}
+	Usage: {r3 code-bench.r [count]}
+]
+
+count: any [attempt [to integer! system/script/args] 3000000]
+
+add3: func [a b c] [a + b + c]
+calls: func [n /local x] [x: 0 loop n [x: add3 x 1 2] x]
+reads: func [n /local a b] [a: 1 b: "b" loop n [a b 10 "s" a b 20] n]
+fib: func [n] [either n < 2 [n] [(fib n - 1) + fib n - 2]]
+
+bench: func [name block /local best t] [
+	best: none
+	loop 5 [
+		recycle
+		t: now/precise
+		do block
+		t: difference now/precise t
+		if any [none? best t < best] [best: t]
+	]
+	print [name best "(best of 5)"]
+]
+
+print ["Count:" count]
+bench "Calls:" [calls count]
+bench "Reads:" [reads count]
+bench "Fib 24:" [fib 24]
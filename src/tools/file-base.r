@@ -26,11 +26,13 @@ core: [
 	c-frame.c
 	c-function.c
 	c-port.c
+	c-rebcode.c
 	c-task.c
 	c-word.c
 	d-crash.c
 	d-dump.c
 	d-print.c
+	d-profile.c
 	f-blocks.c
 	f-deci.c
 	f-dtoa.c
@@ -0,0 +1,264 @@
+REBOL [
+	System: "REBOL [R3] Language Interpreter and Run-time Environment"
+	Title: "Heap snapshot diff"
+	Rights: {
+		Copyright 2012 REBOL Technologies
+		REBOL is a trademark of REBOL Technologies
+	}
+	License: {
+		Licensed under the Apache License, Version 2.0
+		See: http://www.apache.org/licenses/LICENSE-2.0
+	}
+	Purpose: {
+		Compares two heap snapshots made by STATS/heap (see Snap_Heap
+		in m-gc.c), to find what a growing program keeps alive.
+
+		The series of a snapshot form a graph, from the roots. A
+		series dominates another if all paths to it go through it,
+		so its retained size is what would be freed without it.
+		This prints the retained size by dominator path (its type,
+		then those of the series that dominate it) where it grew,
+		then the largest dominators of the second snapshot, with
+		the path of series that first referred to them.
+	}
+	Usage: {r3 heap-diff.r old.snap new.snap}
+]
+
+int32: func [bin [binary!]] [to integer! reverse copy/part bin 4]
+
+pad: func [value width /local str] [
+	str: form value
+	head insert/dup str " " width - length? str
+]
+
+load-snap: func [
+	"Read a snapshot and find its dominators. Blocks are indexed by id + 1."
+	file [file!]
+	/local bin count links snap parent bytes label start succ pstart pred
+		from to n k v w p new order po seen stack idom ret cnt changed meet
+][
+	bin: read file
+	if #{52334853} <> copy/part bin 4 [
+		do make error! reform [file "is not a heap snapshot"]
+	]
+	count: int32 skip bin 8
+	links: int32 skip bin 12
+	bin: skip bin 16
+
+	; Nodes (id 0 is the root):
+	parent: make block! count + 1
+	bytes: make block! count + 1
+	label: make block! count + 1
+	append parent -1
+	append bytes 0
+	append label "root"
+	loop count [
+		append parent int32 bin
+		append bytes int32 skip bin 4
+		append label either zero? bin/13 [
+			join "internal/" bin/14
+		][
+			form pick system/catalog/datatypes bin/13 + 1
+		]
+		bin: skip bin 14
+	]
+
+	; Edges, with one from the root to each series it holds:
+	from: make block! links + count
+	to: make block! links + count
+	repeat n count [
+		if zero? parent/(n + 1) [append from 0 append to n]
+	]
+	loop links [
+		append from int32 bin
+		append to int32 skip bin 4
+		bin: skip bin 8
+	]
+
+	; Successors and predecessors of each node (as offsets):
+	start: array/initial count + 2 0
+	pstart: array/initial count + 2 0
+	foreach n from [start/(n + 2): start/(n + 2) + 1]
+	foreach n to [pstart/(n + 2): pstart/(n + 2) + 1]
+	repeat n count + 1 [
+		start/(n + 1): start/(n + 1) + start/:n
+		pstart/(n + 1): pstart/(n + 1) + pstart/:n
+	]
+	succ: array/initial length? from 0
+	pred: array/initial length? from 0
+	k: copy start
+	p: copy pstart
+	repeat n length? from [
+		v: from/:n
+		w: to/:n
+		k/(v + 1): k/(v + 1) + 1
+		succ/(k/(v + 1)): w
+		p/(w + 1): p/(w + 1) + 1
+		pred/(p/(w + 1)): v
+	]
+
+	; Depth first from the root, for the postorder:
+	order: make block! count + 1
+	po: array/initial count + 1 0
+	seen: array/initial count + 1 false
+	stack: reduce [0 start/1]
+	seen/1: true
+	while [not empty? stack] [
+		v: pick stack (length? stack) - 1
+		k: last stack
+		either k < start/(v + 2) [
+			poke stack length? stack k + 1
+			w: succ/(k + 1)
+			unless seen/(w + 1) [
+				seen/(w + 1): true
+				append stack reduce [w start/(w + 1)]
+			]
+		][
+			append order v
+			po/(v + 1): length? order
+			clear skip tail stack -2
+		]
+	]
+
+	; Dominators (Cooper, Harvey and Kennedy):
+	idom: array/initial count + 1 -1
+	idom/1: 0
+	meet: func [a b] [
+		while [a <> b] [
+			while [po/(a + 1) < po/(b + 1)] [a: idom/(a + 1)]
+			while [po/(b + 1) < po/(a + 1)] [b: idom/(b + 1)]
+		]
+		a
+	]
+	changed: true
+	while [changed] [
+		changed: false
+		for n (length? order) - 1 1 -1 [
+			v: order/:n
+			new: -1
+			k: pstart/(v + 1)
+			while [k < pstart/(v + 2)] [
+				p: pred/(k + 1)
+				if idom/(p + 1) >= 0 [
+					new: either new < 0 [p] [meet p new]
+				]
+				k: k + 1
+			]
+			if new <> idom/(v + 1) [
+				idom/(v + 1): new
+				changed: true
+			]
+		]
+	]
+
+	; Retained size and count (the dominated come first in postorder):
+	ret: copy bytes
+	cnt: array/initial count + 1 1
+	foreach v order [
+		if v > 0 [
+			w: idom/(v + 1) + 1
+			ret/:w: ret/:w + ret/(v + 1)
+			cnt/:w: cnt/:w + cnt/(v + 1)
+		]
+	]
+
+	make object! compose/only [
+		size: (count)
+		parent: (parent)
+		label: (label)
+		idom: (idom)
+		retained: (ret)
+		counts: (cnt)
+	]
+]
+
+dom-path: func [
+	"The labels of a node and of up to 3 of its dominators."
+	snap [object!] n [integer!]
+	/local out
+][
+	out: copy snap/label/(n + 1)
+	loop 3 [
+		n: snap/idom/(n + 1)
+		if n <= 0 [break]
+		append append out " < " snap/label/(n + 1)
+	]
+	out
+]
+
+sum-paths: func [
+	"Retained bytes and count by dominator path, as a map of [bytes count]."
+	snap [object!]
+	/local sums key d
+][
+	sums: make map! 256
+	repeat n snap/size [
+		d: snap/idom/(n + 1)
+		if d >= 0 [
+			key: dom-path snap n
+			; (Not twice for a series held by one of the same path)
+			if any [d = 0 key <> dom-path snap d] [
+				unless sums/:key [sums/:key: copy [0 0]]
+				sums/:key/1: sums/:key/1 + snap/retained/(n + 1)
+				sums/:key/2: sums/:key/2 + snap/counts/(n + 1)
+			]
+		]
+	]
+	sums
+]
+
+retain-path: func [
+	"The labels of the series that first referred to a node, to a root."
+	snap [object!] n [integer!]
+	/local out
+][
+	out: copy ""
+	loop 8 [
+		n: snap/parent/(n + 1)
+		if n <= 0 [return append out "root"]
+		append append out snap/label/(n + 1) " < "
+	]
+	append out "..."
+]
+
+args: parse any [system/script/args ""] none
+if 2 <> length? args [
+	print "Usage: r3 heap-diff.r old.snap new.snap"
+	quit
+]
+
+old: load-snap to-rebol-file args/1
+new: load-snap to-rebol-file args/2
+
+print [
+	"Series:" old/size "->" new/size
+	" retained bytes:" old/retained/1 "->" new/retained/1
+]
+
+a: sum-paths old
+b: sum-paths new
+rows: copy []
+foreach key words-of b [
+	d: any [a/:key [0 0]]
+	if b/:key/1 > d/1 [
+		repend rows [b/:key/1 - d/1 b/:key/2 - d/2 key]
+	]
+]
+sort/skip/reverse rows 3
+
+print "^/Retained size growth by dominator path:"
+print "     bytes    series  path"
+foreach [bytes count key] copy/part rows 60 [
+	print [pad bytes 10 pad count 9 key]
+]
+
+rows: copy []
+repeat n new/size [
+	if new/idom/(n + 1) >= 0 [repend rows [new/retained/(n + 1) n]]
+]
+sort/skip/reverse rows 2
+
+print ["^/Largest dominators in" args/2 {(retained bytes, series, path):}]
+foreach [bytes n] copy/part rows 30 [
+	print [pad bytes 10 pad new/counts/(n + 1) 9 new/label/(n + 1) "<" retain-path new n]
+]
@@ -0,0 +1,52 @@
+REBOL [
+	System: "REBOL [R3] Language Interpreter and Run-time Environment"
+	Title: "Word loading benchmark"
+	Rights: {
+		Copyright 2012 REBOL Technologies
+		REBOL is a trademark of REBOL Technologies
+	}
+	License: {
+		Licensed under the Apache License, Version 2.0
+		See: http://www.apache.org/licenses/LICENSE-2.0
+	}
+	Purpose: {
+		Times LOAD of a word heavy data file, to measure the symbol
+		table (see Make_Word in c-word.c). The file is made first:
+		records of set-words, words in mixed case, and refinements,
+		with a few thousand new words among many repeated ones.
+	}
+	Usage: {r3 load-bench.r [megabytes]}
+]
+
+size: any [attempt [to integer! system/script/args] 4]
+file: %load-bench-data.r
+
+random/seed 1
+names: make block! 2000
+repeat n 2000 [
+	append names rejoin [pick ["item" "field" "value" "node" "key" "x"] n // 6 + 1 "-" n]
+]
+
+data: make string! size * 1100000
+n: 0
+while [size * 1048576 > length? data] [
+	n: n + 1
+	append data rejoin [
+		"rec" n ": [" pick names random 2000 " " uppercase copy pick names random 2000
+		" /" pick names random 2000 " " pick names random 2000 "-" n // 5000
+		" [" pick names random 2000 ": " pick names random 2000 "]]^/"
+	]
+]
+write file data
+print ["Data:" length? data "bytes," n "records"]
+
+best: none
+loop 5 [
+	recycle
+	t: now/precise
+	words: length? load file
+	t: difference now/precise t
+	if any [none? best t < best] [best: t]
+]
+print ["LOAD:" best "(best of 5)," words "values"]
+delete file
@@ -0,0 +1,46 @@
+REBOL [
+	System: "REBOL [R3] Language Interpreter and Run-time Environment"
+	Title: "Function local word benchmark"
+	Rights: {
+		Copyright 2012 REBOL Technologies
+		REBOL is a trademark of REBOL Technologies
+	}
+	License: {
+		Licensed under the Apache License, Version 2.0
+		See: http://www.apache.org/licenses/LICENSE-2.0
+	}
+	Purpose: {
+		Times reads and writes of the args and locals of a function
+		from a block that is run deeper in the stack, by recursive
+		calls, to measure how Get_Var finds the frame of the function
+		(see FUNC_ACTIVE in c-frame.c). Also times plain recursion.
+		Run it with each build to compare them.
+	}
+	Usage: {r3 local-bench.r [depth]}
+]
+
+depth: any [attempt [to integer! system/script/args] 50]
+
+; Runs the block at the given depth of recursive calls:
+deep: func [n block] [either n > 0 [deep n - 1 block] [do block]]
+
+count-up: func [n /local x] [x: 0 deep depth [loop n [x: x + 1]] x]
+sum-down: func [n /local s] [s: n if n > 0 [s: s + sum-down n - 1] s]
+fib: func [n] [either n < 2 [n] [(fib n - 1) + fib n - 2]]
+
+bench: func [name block /local best t] [
+	best: none
+	loop 5 [
+		recycle
+		t: now/precise
+		do block
+		t: difference now/precise t
+		if any [none? best t < best] [best: t]
+	]
+	print [name best "(best of 5)"]
+]
+
+print ["Depth:" depth]
+bench "Locals from depth:" [count-up 200000]
+bench "Recursive sum:" [loop 1000 [sum-down 200]]
+bench "Fib 24:" [fib 24]
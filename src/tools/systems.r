@@ -26,18 +26,18 @@ systems: [
 	[0.2.40 "osx_x64"    posix  [+O1 NPS PIC NCM HID STX -LM]]
 	[0.3.01 "win32"      win32  [+O2 UNI W32 CON S4M EXE DIR -LM]]
 	; platform 0.3.03 is reserved for win32-x64
-	[0.4.02 "linux"      posix  [+O2 LDL ST1 -LM]]		; libc 2.3
-	[0.4.03 "linux"      posix  [+O2 HID LDL ST1 -LM]]	; libc 2.5
-	[0.4.04 "linux"      posix  [+O2 HID LDL ST1 M32 -LM]]	; libc 2.11
-	[0.4.10 "linux_ppc"  posix  [+O1 HID LDL ST1 -LM]]
-	[0.4.20 "linux_arm"  posix  [+O2 HID LDL ST1 -LM]]
+	[0.4.02 "linux"      posix  [+O2 LDL PTH ST1 -LM]]		; libc 2.3
+	[0.4.03 "linux"      posix  [+O2 HID LDL PTH ST1 -LM]]	; libc 2.5
+	[0.4.04 "linux"      posix  [+O2 HID LDL PTH ST1 M32 -LM]]	; libc 2.11
+	[0.4.10 "linux_ppc"  posix  [+O1 HID LDL PTH ST1 -LM]]
+	[0.4.20 "linux_arm"  posix  [+O2 HID LDL PTH ST1 -LM]]
 	[0.4.21 "linux_arm"  posix  [+O2 HID LDL ST1 -LM PIE]]  ; bionic (Android)
-	[0.4.30 "linux_mips" posix  [+O2 HID LDL ST1 -LM]]  ; glibc does not need C++
-	[0.4.40 "linux_x64"  posix  [+O2 HID LDL ST1 -LM]]
+	[0.4.30 "linux_mips" posix  [+O2 HID LDL PTH ST1 -LM]]  ; glibc does not need C++
+	[0.4.40 "linux_x64"  posix  [+O2 HID LDL PTH ST1 -LM]]
 	[0.5.75 "haiku"      posix  [+O2 ST1 NWK]]
-	[0.7.02 "freebsd"    posix  [+O1 C++ ST1 -LM]]
-	[0.7.40 "freebsd_x64"   posix    [+O1 ST1 -LM]]
-	[0.9.04 "openbsd"    posix  [+O1 C++ ST1 -LM]]
+	[0.7.02 "freebsd"    posix  [+O1 C++ PTH ST1 -LM]]
+	[0.7.40 "freebsd_x64"   posix    [+O1 PTH ST1 -LM]]
+	[0.9.04 "openbsd"    posix  [+O1 C++ PTH ST1 -LM]]
 	[0.13.01 "android_arm"  android  [HID F64 LDL LLOG -LM CST]]
 ]
 
@@ -65,6 +65,7 @@ linker-flags: [
 	STA: "--strip-all"
 	C++: "-lstdc++" ; link with stdc++
 	LDL: "-ldl"     ; link with dynamic lib lib
+	PTH: "-lpthread" ; link with posix threads (parallel recycle)
 	LLOG: "-llog"	; on Android, link with liblog.so
 	ARC: "-arch i386" ; x86 32 bit architecture (OSX)
 	M32: "-m32"       ; use 32-bit memory model (Linux x64)